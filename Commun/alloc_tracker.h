@@ -0,0 +1,300 @@
+#pragma once
+
+// Contagem de alocações do C++ (operator new/delete) por frame e por ponto de chamada, para
+// garantir que o laço de cada atividade não aloca depois do aquecimento.
+//
+// Só existe nas compilações com -DALLOC_TRACK (make alocacoes); sem ela as funções abaixo são
+// vazias e o operator new não é trocado. Como o operator new é substituído aqui, o cabeçalho
+// deve ser incluído em um único .cpp do programa (as atividades têm um só).
+//
+//   allocTrackEndFrame();   // no fim de cada frame (o captureEndFrame já chama)
+//   allocTrackStop();       // logo depois do laço principal: o que vier depois (captura,
+//                           // limpeza, relatórios na saída) não conta
+//
+//   { AllocTrackExpected growth(v.size() == v.capacity());  v.push_back(x); }
+//                           // passar da reserva é previsto: contado à parte, não reprova
+//
+// ALLOC_WARMUP=N    frames de aquecimento, em que alocar é permitido (padrão 30)
+// ALLOC_FRAMES=1    mostra cada frame que alocou depois do aquecimento
+// Ao sair, mostra o total por frame e os pontos de chamada que alocaram depois do aquecimento;
+// se algum alocou, o programa sai com código 3. Os pontos de chamada (pilha de chamadas) só
+// são guardados depois do aquecimento. Bibliotecas em C++ no mesmo processo também passam pelo
+// operator new (ex.: o LLVM do llvmpipe ao compilar shaders); malloc direto não entra.
+
+#ifdef ALLOC_TRACK
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <cxxabi.h>
+#include <execinfo.h>
+#include <unistd.h>
+
+constexpr int ALLOC_SITE_DEPTH = 8;   // endereços de retorno guardados por ponto de chamada
+constexpr int ALLOC_SKIP_FRAMES = 2;  // allocTrackRecord e operator new
+constexpr int ALLOC_MAX_SITES = 2048;
+
+struct AllocSite
+{
+    void *frames[ALLOC_SITE_DEPTH];
+    int depth;
+    uint64_t count, bytes; // depois do aquecimento
+};
+
+// Todos os campos têm inicialização constante: o operator new pode ser chamado antes de
+// qualquer construtor global
+struct AllocTracker
+{
+    std::atomic<uint64_t> count{0}, bytes{0}, frees{0};
+    std::atomic<uint64_t> frameCount{0}, frameBytes{0};
+    int frame = 0;
+    int warmup = -1; // lido do ambiente no primeiro fim de frame
+    bool verbose = false;
+    std::atomic<bool> stopped{false}; // escrito pela thread do laço, lido em qualquer operator new
+    uint64_t steadyCount = 0, steadyBytes = 0, maxFrameCount = 0;
+    std::atomic<uint64_t> expectedCount{0}, expectedBytes{0}; // dentro de AllocTrackExpected
+    int steadyFrames = 0, allocatingFrames = 0, firstAllocatingFrame = -1;
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    AllocSite sites[ALLOC_MAX_SITES] = {};
+    int siteCount = 0;
+    uint64_t lostSites = 0; // tabela cheia
+};
+
+inline AllocTracker allocTracker;
+inline thread_local bool allocTrackBusy = false; // o próprio rastreador não é contado
+inline thread_local int allocTrackExpectedDepth = 0;
+
+// Alocações previstas no escopo (ex.: um vetor que passou da reserva inicial e dobra): entram
+// no total, mas não no frame nem nos pontos de chamada
+struct AllocTrackExpected
+{
+    bool active;
+    explicit AllocTrackExpected(bool active = true) : active(active) { allocTrackExpectedDepth += active; }
+    ~AllocTrackExpected() { allocTrackExpectedDepth -= active; }
+};
+
+inline bool allocTrackSteady()
+{
+    return allocTracker.warmup >= 0 && allocTracker.frame >= allocTracker.warmup &&
+           !allocTracker.stopped.load(std::memory_order_relaxed);
+}
+
+inline void allocTrackRecord(size_t size)
+{
+    allocTracker.count.fetch_add(1, std::memory_order_relaxed);
+    allocTracker.bytes.fetch_add(size, std::memory_order_relaxed);
+    if (allocTrackExpectedDepth > 0) {
+        allocTracker.expectedCount.fetch_add(1, std::memory_order_relaxed);
+        allocTracker.expectedBytes.fetch_add(size, std::memory_order_relaxed);
+        return;
+    }
+    allocTracker.frameCount.fetch_add(1, std::memory_order_relaxed);
+    allocTracker.frameBytes.fetch_add(size, std::memory_order_relaxed);
+    if (allocTrackBusy || !allocTrackSteady())
+        return;
+    allocTrackBusy = true;
+    void *frames[ALLOC_SITE_DEPTH + ALLOC_SKIP_FRAMES];
+    int depth = backtrace(frames, ALLOC_SITE_DEPTH + ALLOC_SKIP_FRAMES) - ALLOC_SKIP_FRAMES;
+    if (depth > 0) {
+        uint64_t hash = 1469598103934665603ull;
+        for (int i = 0; i < depth; ++i)
+            hash = (hash ^ uint64_t(frames[ALLOC_SKIP_FRAMES + i])) * 1099511628211ull;
+        while (allocTracker.lock.test_and_set(std::memory_order_acquire))
+            ;
+        // Procura o ponto de chamada na tabela (endereçamento aberto)
+        AllocSite *site = nullptr;
+        for (int probe = 0; probe < ALLOC_MAX_SITES; ++probe) {
+            AllocSite &s = allocTracker.sites[(hash + probe) % ALLOC_MAX_SITES];
+            if (s.depth == 0) {
+                s.depth = depth;
+                memcpy(s.frames, frames + ALLOC_SKIP_FRAMES, depth * sizeof(void *));
+                allocTracker.siteCount++;
+                site = &s;
+                break;
+            }
+            if (s.depth == depth && memcmp(s.frames, frames + ALLOC_SKIP_FRAMES, depth * sizeof(void *)) == 0) {
+                site = &s;
+                break;
+            }
+        }
+        if (site) {
+            site->count++;
+            site->bytes += size;
+        } else {
+            allocTracker.lostSites++;
+        }
+        allocTracker.lock.clear(std::memory_order_release);
+    }
+    allocTrackBusy = false;
+}
+
+// Fecha o frame: frames depois do aquecimento não podem ter alocado
+inline void allocTrackEndFrame()
+{
+    if (allocTracker.warmup < 0) {
+        const char *warmup = getenv("ALLOC_WARMUP");
+        allocTracker.warmup = warmup ? std::max(0, atoi(warmup)) : 30;
+        allocTracker.verbose = getenv("ALLOC_FRAMES") != nullptr;
+    }
+    uint64_t count = allocTracker.frameCount.exchange(0, std::memory_order_relaxed);
+    uint64_t bytes = allocTracker.frameBytes.exchange(0, std::memory_order_relaxed);
+    if (allocTrackSteady()) {
+        allocTracker.steadyFrames++;
+        allocTracker.steadyCount += count;
+        allocTracker.steadyBytes += bytes;
+        allocTracker.maxFrameCount = std::max(allocTracker.maxFrameCount, count);
+        if (count > 0) {
+            allocTracker.allocatingFrames++;
+            if (allocTracker.firstAllocatingFrame < 0)
+                allocTracker.firstAllocatingFrame = allocTracker.frame;
+            if (allocTracker.verbose)
+                fprintf(stderr, "alocações: frame %d alocou %llu vezes (%llu bytes)\n", allocTracker.frame,
+                        (unsigned long long)count, (unsigned long long)bytes);
+        }
+    }
+    allocTracker.frame++;
+}
+
+inline void allocTrackStop()
+{
+    allocTracker.stopped.store(true, std::memory_order_relaxed);
+}
+
+// Nome legível de uma linha do backtrace_symbols (desfaz o mangling do C++ quando possível)
+inline void allocTrackPrintFrame(FILE *out, const char *line)
+{
+    const char *start = strstr(line, "_Z");
+    if (start) {
+        size_t length = strcspn(start, "+) \t");
+        char mangled[512];
+        length = std::min(length, sizeof(mangled) - 1);
+        memcpy(mangled, start, length);
+        mangled[length] = '\0';
+        int status = 0;
+        if (char *name = abi::__cxa_demangle(mangled, nullptr, nullptr, &status)) {
+            fprintf(out, "      %s\n", name);
+            free(name);
+            return;
+        }
+    }
+    fprintf(out, "      %s\n", line);
+}
+
+inline void allocTrackReport(FILE *out, int maxSites = 10)
+{
+    allocTrackBusy = true;
+    double frames = std::max(1, allocTracker.frame);
+    fprintf(out, "alocações: %llu no total (%.1f por frame, %.1f KB por frame) em %d frames, %llu liberações\n",
+            (unsigned long long)allocTracker.count.load(), allocTracker.count.load() / frames,
+            allocTracker.bytes.load() / frames / 1024.0, allocTracker.frame, (unsigned long long)allocTracker.frees.load());
+    fprintf(out, "alocações depois do aquecimento (%d frames): %llu em %d de %d frames (%llu bytes, máx. %llu por frame)\n",
+            std::max(0, allocTracker.warmup), (unsigned long long)allocTracker.steadyCount, allocTracker.allocatingFrames,
+            allocTracker.steadyFrames, (unsigned long long)allocTracker.steadyBytes,
+            (unsigned long long)allocTracker.maxFrameCount);
+    if (allocTracker.expectedCount.load() > 0)
+        fprintf(out, "alocações previstas (passaram da reserva): %llu (%llu bytes)\n",
+                (unsigned long long)allocTracker.expectedCount.load(), (unsigned long long)allocTracker.expectedBytes.load());
+    if (allocTracker.steadyCount == 0) {
+        allocTrackBusy = false;
+        return;
+    }
+    fprintf(out, "primeiro frame com alocação: %d\n", allocTracker.firstAllocatingFrame);
+    // Pontos de chamada que alocaram depois do aquecimento, os que mais alocaram primeiro
+    AllocSite *order[ALLOC_MAX_SITES];
+    int n = 0;
+    for (AllocSite &s : allocTracker.sites)
+        if (s.count > 0)
+            order[n++] = &s;
+    std::sort(order, order + n, [](AllocSite *a, AllocSite *b) { return a->count > b->count; });
+    for (int i = 0; i < n && i < maxSites; ++i) {
+        fprintf(out, "  %llu alocações, %llu bytes depois do aquecimento:\n", (unsigned long long)order[i]->count,
+                (unsigned long long)order[i]->bytes);
+        char **lines = backtrace_symbols(order[i]->frames, order[i]->depth);
+        for (int k = 0; lines && k < order[i]->depth; ++k)
+            allocTrackPrintFrame(out, lines[k]);
+        free(lines);
+    }
+    if (allocTracker.lostSites)
+        fprintf(out, "  (%llu alocações sem ponto de chamada: tabela cheia)\n", (unsigned long long)allocTracker.lostSites);
+    allocTrackBusy = false;
+}
+
+// Relatório na saída do programa; alocação depois do aquecimento vira código de saída 3
+struct AllocTrackExit
+{
+    ~AllocTrackExit()
+    {
+        if (allocTracker.warmup < 0)
+            return; // o programa não chegou a desenhar um frame
+        allocTrackReport(stderr);
+        if (allocTracker.steadyCount > 0) {
+            fflush(stdout);
+            fflush(stderr);
+            _exit(3);
+        }
+    }
+};
+
+inline AllocTrackExit allocTrackExit;
+
+// Substituições globais (fora de inline: valem para o programa todo)
+void *operator new(size_t size)
+{
+    allocTrackRecord(size);
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    allocTrackRecord(size);
+    return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept { return operator new(size, tag); }
+
+void *operator new(size_t size, std::align_val_t align)
+{
+    allocTrackRecord(size);
+    size_t a = std::max(size_t(align), sizeof(void *));
+    void *p = nullptr;
+    if (posix_memalign(&p, a, size ? size : 1) != 0)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size, std::align_val_t align) { return operator new(size, align); }
+
+void operator delete(void *p) noexcept
+{
+    if (p)
+        allocTracker.frees.fetch_add(1, std::memory_order_relaxed);
+    free(p);
+}
+
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t) noexcept { operator delete(p); }
+void operator delete(void *p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { operator delete(p); }
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { operator delete(p); }
+
+#else
+
+inline void allocTrackEndFrame() {}
+inline void allocTrackStop() {}
+
+struct AllocTrackExpected
+{
+    explicit AllocTrackExpected(bool = true) {}
+};
+
+#endif
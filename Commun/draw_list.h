@@ -0,0 +1,285 @@
+#pragma once
+
+// Lista de comandos de desenho indireto para cenas que misturam formas (leques, listas,
+// strips). Todas as malhas ficam em um único VBO/EBO; cada desenho vira um comando
+// DrawElementsIndirect agrupado pelo modo de primitiva, e a cor/transformação de cada
+// desenho é lida de um texture buffer pelo índice do desenho.
+//
+// Com GL 4.3 (glMultiDrawElementsIndirect + baseInstance), cada modo é uma única chamada
+// e o índice do desenho chega pelo atributo instanciado 'drawIndex' (baseInstance = índice).
+// No loader 4.0 (e no macOS, limitado a 4.1) a lista faz um laço de glDrawElementsIndirect
+// com o índice em um uniform, já que baseInstance precisa ser zero antes do 4.2.
+//
+// Os comandos e parâmetros de cada frame ficam na arena da thread (frame_arena.h): o programa
+// chama frameArenaReset() no começo do frame, antes do drawListBegin.
+
+#include <vector>
+#include <glad/glad.h>
+#include "shader.h"
+#include "frame_arena.h"
+
+// Layout definido pela especificação do OpenGL
+struct DrawElementsIndirectCommand
+{
+    GLuint count, instanceCount, firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+// Por desenho: deslocamento (NDC), escala e rotação, depois a cor = 2 texels RGBA32F
+struct DrawParams
+{
+    float offsetX, offsetY, scale, rotation;
+    float r, g, b, a;
+};
+
+inline DrawParams makeDrawParams(float x, float y, float scale, float rotation, float r, float g, float b)
+{
+    return {x, y, scale, rotation, r, g, b, 1.0f};
+}
+
+// Uma malha registrada: trecho do EBO compartilhado
+struct DrawMesh
+{
+    GLenum mode;
+    GLuint firstIndex, count;
+    GLint baseVertex;
+};
+
+// Comandos de um mesmo modo de primitiva, em ordem de chegada
+struct DrawBucket
+{
+    GLenum mode;
+    FrameVector<DrawElementsIndirectCommand> commands;
+    FrameVector<GLint> drawIds; // usados só no laço sem multi-draw
+};
+
+typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC_)(GLenum mode, GLenum type, const void *indirect,
+                                                             GLsizei drawcount, GLsizei stride);
+
+inline const char *const drawListVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+layout (location = 1) in uint drawIndex;   // = baseInstance no caminho multi-draw
+uniform int u_drawOffset;                  // índice do desenho no laço sem multi-draw
+uniform samplerBuffer u_params;
+out vec4 vColor;
+void main() {
+    int id = int(drawIndex) + u_drawOffset;
+    vec4 xf = texelFetch(u_params, 2 * id);
+    vColor = texelFetch(u_params, 2 * id + 1);
+    float c = cos(xf.w), s = sin(xf.w);
+    vec2 p = position.xy * xf.z;
+    gl_Position = vec4(vec2(c * p.x - s * p.y, s * p.x + c * p.y) + xf.xy, 0.0, 1.0);
+}
+)";
+
+inline const char *const drawListFragmentShaderSource = R"(
+#version 400
+in vec4 vColor;
+out vec4 color;
+void main() {
+    color = vColor;
+}
+)";
+
+struct DrawList
+{
+    GLuint program = 0, VAO = 0, VBO = 0, EBO = 0, drawIdVBO = 0, indirectBuffer = 0;
+    GLuint paramsBuffer = 0, paramsTexture = 0;
+    GLint drawOffsetLoc = -1;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC_ multiDrawElementsIndirect = nullptr;
+    bool useMultiDraw = false;
+
+    std::vector<float> vertices;   // malhas registradas (x, y, z)
+    std::vector<GLuint> indices;
+    std::vector<DrawMesh> meshes;
+
+    std::vector<DrawBucket> buckets;
+    FrameVector<DrawParams> params;
+    size_t drawIdCapacity = 0;     // índices 0..N-1 no drawIdVBO
+    int submitCalls = 0;           // chamadas de desenho no último drawListSubmit
+};
+
+// 'load' é o mesmo carregador passado ao GLAD (glfwGetProcAddress)
+inline DrawList createDrawList(GLADloadproc load)
+{
+    DrawList list;
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    if (major > 4 || (major == 4 && minor >= 3))
+        list.multiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC_)load("glMultiDrawElementsIndirect");
+    list.useMultiDraw = list.multiDrawElementsIndirect != nullptr;
+
+    list.program = buildShaderProgram(drawListVertexShaderSource, drawListFragmentShaderSource);
+    list.drawOffsetLoc = glGetUniformLocation(list.program, "u_drawOffset");
+
+    glGenVertexArrays(1, &list.VAO);
+    glGenBuffers(1, &list.VBO);
+    glGenBuffers(1, &list.EBO);
+    glGenBuffers(1, &list.drawIdVBO);
+    glGenBuffers(1, &list.indirectBuffer);
+    glGenBuffers(1, &list.paramsBuffer);
+    glGenTextures(1, &list.paramsTexture);
+
+    glBindVertexArray(list.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, list.VBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, list.drawIdVBO);
+    glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(GLuint), (GLvoid *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.EBO);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return list;
+}
+
+// Registra uma malha; sem índices, usa os vértices em ordem. Retorna o id da malha.
+inline int drawListAddMesh(DrawList &list, GLenum mode, const float *xyz, size_t vertexCount,
+                           const GLuint *meshIndices = nullptr, size_t indexCount = 0)
+{
+    DrawMesh mesh;
+    mesh.mode = mode;
+    mesh.baseVertex = GLint(list.vertices.size() / 3);
+    mesh.firstIndex = GLuint(list.indices.size());
+    list.vertices.insert(list.vertices.end(), xyz, xyz + vertexCount * 3);
+    if (meshIndices) {
+        list.indices.insert(list.indices.end(), meshIndices, meshIndices + indexCount);
+        mesh.count = GLuint(indexCount);
+    } else {
+        for (size_t i = 0; i < vertexCount; ++i)
+            list.indices.push_back(GLuint(i));
+        mesh.count = GLuint(vertexCount);
+    }
+    list.meshes.push_back(mesh);
+    return int(list.meshes.size()) - 1;
+}
+
+// Envia as malhas registradas (uma vez, depois de todos os drawListAddMesh)
+inline void drawListUploadMeshes(DrawList &list)
+{
+    glBindVertexArray(list.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, list.VBO);
+    glBufferData(GL_ARRAY_BUFFER, list.vertices.size() * sizeof(float), list.vertices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, list.indices.size() * sizeof(GLuint), list.indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Começa os comandos do frame na arena já zerada; reserva o tamanho do frame anterior, para
+// os vetores não crescerem aos pedaços dentro da arena
+inline void drawListBegin(DrawList &list)
+{
+    for (DrawBucket &bucket : list.buckets) {
+        size_t commands = bucket.commands.size();
+        bucket.commands = FrameVector<DrawElementsIndirectCommand>();
+        bucket.commands.reserve(commands);
+        bucket.drawIds = FrameVector<GLint>();
+        if (!list.useMultiDraw)
+            bucket.drawIds.reserve(commands);
+    }
+    size_t draws = list.params.size();
+    list.params = FrameVector<DrawParams>();
+    list.params.reserve(draws);
+}
+
+// Acrescenta um desenho da malha 'meshId' com sua cor/transformação
+inline void drawListAdd(DrawList &list, int meshId, const DrawParams &params)
+{
+    const DrawMesh &mesh = list.meshes[meshId];
+    DrawBucket *bucket = nullptr;
+    for (DrawBucket &b : list.buckets)
+        if (b.mode == mesh.mode)
+            bucket = &b;
+    if (!bucket) {
+        list.buckets.push_back({mesh.mode, {}, {}});
+        bucket = &list.buckets.back();
+    }
+    GLuint drawId = GLuint(list.params.size());
+    list.params.push_back(params);
+    bucket->commands.push_back({mesh.count, 1, mesh.firstIndex, mesh.baseVertex, list.useMultiDraw ? drawId : 0});
+    if (!list.useMultiDraw)
+        bucket->drawIds.push_back(GLint(drawId));
+}
+
+// Envia comandos e parâmetros do frame e desenha: uma chamada por modo com multi-draw
+inline void drawListSubmit(DrawList &list)
+{
+    list.submitCalls = 0;
+    if (list.params.empty())
+        return;
+
+    // Índices 0..N-1 para o atributo drawIndex (só cresce)
+    if (list.useMultiDraw && list.params.size() > list.drawIdCapacity) {
+        list.drawIdCapacity = list.params.size() * 2;
+        FrameVector<GLuint> ids(list.drawIdCapacity);
+        for (size_t i = 0; i < ids.size(); ++i)
+            ids[i] = GLuint(i);
+        glBindBuffer(GL_ARRAY_BUFFER, list.drawIdVBO);
+        glBufferData(GL_ARRAY_BUFFER, ids.size() * sizeof(GLuint), ids.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    } else if (!list.useMultiDraw && list.drawIdCapacity == 0) {
+        GLuint zero = 0;
+        list.drawIdCapacity = 1;
+        glBindBuffer(GL_ARRAY_BUFFER, list.drawIdVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLuint), &zero, GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // Parâmetros: o buffer é recriado (orphan) a cada frame
+    glBindBuffer(GL_TEXTURE_BUFFER, list.paramsBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, list.params.size() * sizeof(DrawParams), list.params.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, list.paramsTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, list.paramsBuffer);
+
+    // Comandos de todos os modos em um único buffer indireto, um trecho por modo
+    size_t totalCommands = 0;
+    for (const DrawBucket &bucket : list.buckets)
+        totalCommands += bucket.commands.size();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, list.indirectBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, totalCommands * sizeof(DrawElementsIndirectCommand), nullptr, GL_STREAM_DRAW);
+    size_t offset = 0;
+    for (const DrawBucket &bucket : list.buckets) {
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, offset * sizeof(DrawElementsIndirectCommand),
+                        bucket.commands.size() * sizeof(DrawElementsIndirectCommand), bucket.commands.data());
+        offset += bucket.commands.size();
+    }
+
+    glUseProgram(list.program);
+    glUniform1i(list.drawOffsetLoc, 0);
+    glBindVertexArray(list.VAO);
+    offset = 0;
+    for (const DrawBucket &bucket : list.buckets) {
+        if (bucket.commands.empty())
+            continue;
+        const char *base = (const char *)(offset * sizeof(DrawElementsIndirectCommand));
+        if (list.useMultiDraw) {
+            list.multiDrawElementsIndirect(bucket.mode, GL_UNSIGNED_INT, base, GLsizei(bucket.commands.size()), 0);
+            list.submitCalls++;
+        } else {
+            for (size_t i = 0; i < bucket.commands.size(); ++i) {
+                glUniform1i(list.drawOffsetLoc, bucket.drawIds[i]);
+                glDrawElementsIndirect(bucket.mode, GL_UNSIGNED_INT, base + i * sizeof(DrawElementsIndirectCommand));
+            }
+            list.submitCalls += int(bucket.commands.size());
+        }
+        offset += bucket.commands.size();
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+inline void deleteDrawList(DrawList &list)
+{
+    glDeleteVertexArrays(1, &list.VAO);
+    GLuint buffers[] = {list.VBO, list.EBO, list.drawIdVBO, list.indirectBuffer, list.paramsBuffer};
+    glDeleteBuffers(5, buffers);
+    glDeleteTextures(1, &list.paramsTexture);
+    glDeleteProgram(list.program);
+    list = DrawList();
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+// Arena linear por frame para dados temporários (comandos de desenho, saída do descarte,
+// rastro de chamadas...): alocar é só avançar um deslocamento e tudo é liberado de uma vez no
+// começo do frame seguinte. Cada thread tem a sua arena (frameArena), sem trava.
+//
+//   frameArenaReset();                          // no começo de cada frame, em cada thread
+//   FrameVector<DrawParams> params;             // std::vector que aloca na arena da thread
+//   params.reserve(n);
+//   float *tmp = frameArenaNew<float>(6);       // bloco solto, sem destrutor
+//
+// Nada alocado na arena pode sobreviver ao frameArenaReset seguinte. Quando um frame não cabe
+// no bloco atual a arena pega outro bloco no heap e, no reset, junta tudo em um bloco do
+// tamanho do maior frame visto; depois do aquecimento nenhum frame aloca no heap, e
+// frameArenaHeapAllocations() mostra isso. Subsistemas cujo "frame" fecha em outro ponto podem
+// ter uma FrameArena própria e passá-la ao FrameAllocator.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+constexpr size_t FRAME_ARENA_MIN_BLOCK = 64 * 1024;
+
+struct FrameArenaBlock
+{
+    unsigned char *data;
+    size_t size;
+};
+
+struct FrameArena
+{
+    std::vector<FrameArenaBlock> blocks; // um só depois do aquecimento
+    size_t block = 0, offset = 0;       // bloco atual e posição livre nele
+    size_t used = 0, peak = 0;          // bytes pedidos neste frame / maior frame
+    size_t lastFrameBytes = 0;
+    uint64_t heapAllocations = 0;       // blocos pegos no heap desde o início
+    uint64_t frameHeapAllocations = 0;  // ... neste frame
+    uint64_t lastFrameHeapAllocations = 0;
+
+    FrameArena() = default;
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+    ~FrameArena()
+    {
+        for (FrameArenaBlock &b : blocks)
+            free(b.data);
+    }
+};
+
+// Total de blocos pegos no heap por todas as arenas (para mostrar em um só contador)
+inline std::atomic<uint64_t> frameArenaTotalHeapAllocations{0};
+
+inline thread_local FrameArena frameArena;
+
+inline bool frameArenaGrow(FrameArena &arena, size_t bytes)
+{
+    FrameArenaBlock b;
+    b.size = std::max({bytes, FRAME_ARENA_MIN_BLOCK, arena.blocks.empty() ? 0 : arena.blocks.back().size * 2});
+    b.data = (unsigned char *)malloc(b.size);
+    if (!b.data)
+        return false;
+    arena.blocks.push_back(b);
+    arena.heapAllocations++;
+    arena.frameHeapAllocations++;
+    frameArenaTotalHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+inline void *frameArenaAlloc(FrameArena &arena, size_t size, size_t align = alignof(std::max_align_t))
+{
+    size = std::max<size_t>(size, 1);
+    while (true) {
+        if (arena.block < arena.blocks.size()) {
+            FrameArenaBlock &b = arena.blocks[arena.block];
+            size_t start = (size_t(b.data) + arena.offset + align - 1) & ~(align - 1);
+            size_t end = start - size_t(b.data) + size;
+            if (end <= b.size) {
+                arena.offset = end;
+                arena.used += size;
+                return (void *)start;
+            }
+            if (arena.block + 1 < arena.blocks.size()) {
+                arena.block++;
+                arena.offset = 0;
+                continue;
+            }
+        }
+        if (!frameArenaGrow(arena, size + align))
+            throw std::bad_alloc();
+        arena.block = arena.blocks.size() - 1;
+        arena.offset = 0;
+    }
+}
+
+inline void *frameArenaAlloc(size_t size, size_t align = alignof(std::max_align_t))
+{
+    return frameArenaAlloc(frameArena, size, align);
+}
+
+// 'count' elementos de T não inicializados (T trivial: não há destrutor)
+template <typename T> T *frameArenaNew(FrameArena &arena, size_t count)
+{
+    static_assert(std::is_trivially_destructible_v<T>, "a arena não chama destrutores");
+    return (T *)frameArenaAlloc(arena, count * sizeof(T), alignof(T));
+}
+
+template <typename T> T *frameArenaNew(size_t count) { return frameArenaNew<T>(frameArena, count); }
+
+// Libera tudo o que foi alocado desde o último reset
+inline void frameArenaReset(FrameArena &arena)
+{
+    arena.peak = std::max(arena.peak, arena.used);
+    arena.lastFrameBytes = arena.used;
+    arena.lastFrameHeapAllocations = arena.frameHeapAllocations;
+    arena.frameHeapAllocations = 0;
+    arena.used = 0;
+    arena.block = 0;
+    arena.offset = 0;
+    if (arena.blocks.size() <= 1)
+        return;
+    // O frame passou de um bloco: troca todos por um só que caiba o maior frame (com folga
+    // para o alinhamento); esse bloco conta no frame que começa
+    size_t total = 0;
+    for (FrameArenaBlock &b : arena.blocks) {
+        total += b.size;
+        free(b.data);
+    }
+    arena.blocks.clear();
+    frameArenaGrow(arena, std::max(total, arena.peak + arena.peak / 8));
+}
+
+inline void frameArenaReset() { frameArenaReset(frameArena); }
+
+inline uint64_t frameArenaHeapAllocations() { return frameArenaTotalHeapAllocations.load(std::memory_order_relaxed); }
+
+// Alocador de STL sobre uma arena (por padrão a da thread que cria o alocador). deallocate
+// não faz nada: a memória volta no frameArenaReset.
+template <typename T>
+struct FrameAllocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    FrameArena *arena;
+
+    FrameAllocator() : arena(&frameArena) {}
+    explicit FrameAllocator(FrameArena &a) : arena(&a) {}
+    template <typename U> FrameAllocator(const FrameAllocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t n) { return (T *)frameArenaAlloc(*arena, n * sizeof(T), alignof(T)); }
+    void deallocate(T *, size_t) {}
+
+    template <typename U> bool operator==(const FrameAllocator<U> &other) const { return arena == other.arena; }
+    template <typename U> bool operator!=(const FrameAllocator<U> &other) const { return arena != other.arena; }
+};
+
+template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
@@ -0,0 +1,94 @@
+#pragma once
+
+// Captura de um frame em PNG, para os testes de imagem de referência (make golden).
+//
+// Uso em um programa:
+//   captureWindowHints();           // antes do glfwCreateWindow: janela oculta ao capturar
+//   captureInit();                  // depois do GLAD, lê as variáveis de ambiente abaixo
+//   captureTime();                  // no lugar do glfwGetTime em animações
+//   captureEndFrame(window);        // logo antes do glfwSwapBuffers (também fecha o frame
+//                                   // da contagem de alocações, alloc_tracker.h)
+//   captureEndFrame(window, w, h);  // o mesmo fora da thread principal, com o tamanho do
+//                                   // framebuffer lido nela
+//
+// CAPTURE_PNG=arquivo.png  grava o buffer de cor do frame CAPTURE_FRAME (5) e fecha a janela
+// CAPTURE_CLOSE_FRAME=N    só fecha a janela (oculta) no fim do frame N, sem capturar: o laço
+//                          roda como ao vivo, com o relógio real (make alocacoes)
+// Durante a captura o relógio das animações avança 1/60 s por frame, então a imagem não
+// depende da velocidade da máquina.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "png_image.h"
+#include "alloc_tracker.h"
+
+struct CaptureState
+{
+    const char *path = nullptr;
+    int frame = 0;
+    int target = 5;
+    int closeFrame = 0; // CAPTURE_CLOSE_FRAME (0: não fecha)
+};
+
+inline CaptureState captureState;
+
+inline bool captureEnabled()
+{
+    return getenv("CAPTURE_PNG") != nullptr;
+}
+
+inline void captureWindowHints()
+{
+    if (captureEnabled() || getenv("CAPTURE_CLOSE_FRAME"))
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+}
+
+inline void captureInit()
+{
+    captureState.path = getenv("CAPTURE_PNG");
+    if (const char *frame = getenv("CAPTURE_FRAME"))
+        captureState.target = std::max(1, atoi(frame));
+    if (const char *frame = getenv("CAPTURE_CLOSE_FRAME"))
+        captureState.closeFrame = std::max(1, atoi(frame));
+}
+
+inline double captureTime()
+{
+    return captureState.path ? captureState.frame / 60.0 : glfwGetTime();
+}
+
+// Lê o back buffer inteiro (antes da troca) no frame escolhido. width x height é o tamanho do
+// framebuffer; o glfwGetFramebufferSize só pode ser chamado na thread principal.
+inline void captureEndFrame(GLFWwindow *window, int width, int height)
+{
+    allocTrackEndFrame();
+    ++captureState.frame;
+    if (captureState.frame == captureState.closeFrame)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (!captureState.path || captureState.frame != captureState.target)
+        return;
+    allocTrackStop(); // gravar o PNG aloca, mas já não faz parte do laço
+    std::vector<uint8_t> pixels(size_t(width) * height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadBuffer(GL_BACK);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    // O alfa do buffer da janela não é visível; grava opaco para não depender do driver
+    for (size_t i = 3; i < pixels.size(); i += 4)
+        pixels[i] = 255;
+    if (pngWrite(captureState.path, pixels.data(), width, height))
+        printf("captura: %s (%dx%d, frame %d)\n", captureState.path, width, height, captureState.frame);
+    glfwSetWindowShouldClose(window, GL_TRUE);
+}
+
+// Na thread principal: lê o tamanho do framebuffer só no frame capturado
+inline void captureEndFrame(GLFWwindow *window)
+{
+    int width = 0, height = 0;
+    if (captureState.path && captureState.frame + 1 == captureState.target)
+        glfwGetFramebufferSize(window, &width, &height);
+    captureEndFrame(window, width, height);
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+// Cache fino do estado do OpenGL: guarda o último programa, VAO, buffers por alvo, viewport,
+// tamanho de ponto, largura de linha e cor de limpeza, e só repassa ao driver as mudanças
+// reais. Conta por frame as chamadas enviadas e as filtradas.
+// Todo o código que mexe nesse estado deve passar pelas funções abaixo; se algo chamar o
+// GL diretamente (por exemplo os helpers de Commun/), chame stateInvalidate() em seguida.
+
+#include <glad/glad.h>
+
+constexpr GLuint STATE_UNKNOWN = 0xFFFFFFFFu;
+
+// Alvos de buffer acompanhados (os demais passam direto)
+enum StateBufferTarget
+{
+    STATE_ARRAY_BUFFER = 0,
+    STATE_ELEMENT_ARRAY_BUFFER,
+    STATE_COPY_READ_BUFFER,
+    STATE_COPY_WRITE_BUFFER,
+    STATE_DRAW_INDIRECT_BUFFER,
+    STATE_TEXTURE_BUFFER,
+    STATE_UNIFORM_BUFFER,
+    STATE_BUFFER_TARGETS
+};
+
+struct GLStateCounters
+{
+    int issued = 0;   // chamadas repassadas ao driver
+    int filtered = 0; // chamadas descartadas por não mudarem nada
+};
+
+struct GLStateCache
+{
+    GLuint program = STATE_UNKNOWN;
+    GLuint vertexArray = STATE_UNKNOWN;
+    GLuint buffers[STATE_BUFFER_TARGETS];
+    GLint viewport[4];
+    float pointSize, lineWidth;
+    float clearColor[4];
+    GLStateCounters frame;
+    bool enabled = true; // false repassa tudo (para comparação)
+
+    GLStateCache() { invalidate(); }
+
+    void invalidate()
+    {
+        program = vertexArray = STATE_UNKNOWN;
+        for (GLuint &b : buffers)
+            b = STATE_UNKNOWN;
+        viewport[0] = viewport[1] = viewport[2] = viewport[3] = -1;
+        pointSize = lineWidth = -1.0f;
+        clearColor[0] = clearColor[1] = clearColor[2] = clearColor[3] = -1.0f;
+    }
+};
+
+inline GLStateCache glState;
+
+inline int stateBufferIndex(GLenum target)
+{
+    switch (target) {
+    case GL_ARRAY_BUFFER: return STATE_ARRAY_BUFFER;
+    case GL_ELEMENT_ARRAY_BUFFER: return STATE_ELEMENT_ARRAY_BUFFER;
+    case GL_COPY_READ_BUFFER: return STATE_COPY_READ_BUFFER;
+    case GL_COPY_WRITE_BUFFER: return STATE_COPY_WRITE_BUFFER;
+    case GL_DRAW_INDIRECT_BUFFER: return STATE_DRAW_INDIRECT_BUFFER;
+    case GL_TEXTURE_BUFFER: return STATE_TEXTURE_BUFFER;
+    case GL_UNIFORM_BUFFER: return STATE_UNIFORM_BUFFER;
+    default: return -1;
+    }
+}
+
+// Retorna true se a chamada deve ir ao driver, atualizando os contadores
+inline bool stateChanged(bool changed)
+{
+    if (changed || !glState.enabled) {
+        glState.frame.issued++;
+        return true;
+    }
+    glState.frame.filtered++;
+    return false;
+}
+
+inline void stateInvalidate() { glState.invalidate(); }
+
+// Devolve os contadores do frame e zera para o próximo
+inline GLStateCounters stateEndFrame()
+{
+    GLStateCounters counters = glState.frame;
+    glState.frame = GLStateCounters();
+    return counters;
+}
+
+inline void stateUseProgram(GLuint program)
+{
+    if (stateChanged(glState.program != program)) {
+        glUseProgram(program);
+        glState.program = program;
+    }
+}
+
+inline void stateBindVertexArray(GLuint vertexArray)
+{
+    if (stateChanged(glState.vertexArray != vertexArray)) {
+        glBindVertexArray(vertexArray);
+        glState.vertexArray = vertexArray;
+        // O GL_ELEMENT_ARRAY_BUFFER faz parte do VAO
+        glState.buffers[STATE_ELEMENT_ARRAY_BUFFER] = STATE_UNKNOWN;
+    }
+}
+
+inline void stateBindBuffer(GLenum target, GLuint buffer)
+{
+    int index = stateBufferIndex(target);
+    if (index < 0) {
+        glState.frame.issued++;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (stateChanged(glState.buffers[index] != buffer)) {
+        glBindBuffer(target, buffer);
+        glState.buffers[index] = buffer;
+    }
+}
+
+inline void stateViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    GLint *v = glState.viewport;
+    if (stateChanged(v[0] != x || v[1] != y || v[2] != width || v[3] != height)) {
+        glViewport(x, y, width, height);
+        v[0] = x;
+        v[1] = y;
+        v[2] = width;
+        v[3] = height;
+    }
+}
+
+inline void statePointSize(float size)
+{
+    if (stateChanged(glState.pointSize != size)) {
+        glPointSize(size);
+        glState.pointSize = size;
+    }
+}
+
+inline void stateLineWidth(float width)
+{
+    if (stateChanged(glState.lineWidth != width)) {
+        glLineWidth(width);
+        glState.lineWidth = width;
+    }
+}
+
+inline void stateClearColor(float r, float g, float b, float a)
+{
+    float *c = glState.clearColor;
+    if (stateChanged(c[0] != r || c[1] != g || c[2] != b || c[3] != a)) {
+        glClearColor(r, g, b, a);
+        c[0] = r;
+        c[1] = g;
+        c[2] = b;
+        c[3] = a;
+    }
+}
+
+// Exclusões: o GL desfaz a ligação de objetos excluídos e pode reaproveitar os IDs,
+// então o cache esquece qualquer referência a eles
+inline void stateDeleteVertexArray(GLuint vertexArray)
+{
+    glDeleteVertexArrays(1, &vertexArray);
+    if (glState.vertexArray == vertexArray) {
+        glState.vertexArray = 0;
+        glState.buffers[STATE_ELEMENT_ARRAY_BUFFER] = STATE_UNKNOWN;
+    }
+}
+
+inline void stateDeleteBuffer(GLuint buffer)
+{
+    glDeleteBuffers(1, &buffer);
+    for (GLuint &b : glState.buffers)
+        if (b == buffer)
+            b = STATE_UNKNOWN;
+}
+
+inline void stateDeleteProgram(GLuint program)
+{
+    glDeleteProgram(program);
+    if (glState.program == program)
+        glState.program = STATE_UNKNOWN; // o programa em uso só é apagado quando deixa de ser usado
+}
@@ -0,0 +1,454 @@
+#pragma once
+
+// Rastreamento de chamadas do OpenGL pelos ponteiros glad_gl*: glTraceInstall() troca cada
+// ponteiro carregado por um wrapper que conta as chamadas por função, mede o tempo de CPU
+// gasto no driver e, opcionalmente, grava um rastro binário que pode ser reproduzido.
+//
+// Uso em um programa (depois do gladLoadGLLoader):
+//   glTraceInitFromEnv();   // GL_TRACE=1 liga as estatísticas, GL_TRACE_FILE=arquivo grava o rastro
+//   ... glTraceEndFrame() antes de cada glfwSwapBuffers ... glTraceShutdown() no fim
+//
+// O rastro guarda os argumentos por valor. Ponteiros com tamanho conhecido (dados de buffer,
+// uniforms, nomes, fontes de shader, texturas RGBA8...) têm o conteúdo copiado; ponteiros de
+// saída (glGen*, glGet*) recebem uma área temporária na reprodução; os demais são tratados
+// como deslocamentos em buffers ligados. A reprodução supõe que o driver devolve os mesmos
+// IDs de objetos e locations; escritas em buffers mapeados não são reproduzidas.
+// As chamadas de um frame são gravadas em uma arena própria (frame_arena.h) e escritas no
+// arquivo de uma vez no glTraceEndFrame.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <glad/glad.h>
+#include "frame_arena.h"
+
+enum GLTraceFunctionId
+{
+#define GL_TRACE_FUNCTION(name) GLTRACE_ID_##name,
+#include "gl_trace_functions.h"
+#undef GL_TRACE_FUNCTION
+    GLTRACE_FUNCTION_COUNT
+};
+
+constexpr uint16_t GLTRACE_FRAME_MARKER = 0xFFFF;
+constexpr char GLTRACE_MAGIC[8] = {'G', 'L', 'T', 'R', 'A', 'C', 'E', '1'};
+
+// Leitura sequencial de um rastro carregado inteiro na memória
+struct GLTraceReader
+{
+    std::vector<unsigned char> data;
+    size_t pos = 0;
+    std::vector<int> localIds; // id no arquivo -> id desta compilação (-1 se desconhecido)
+
+    template <typename T> T read()
+    {
+        T value{};
+        if (pos + sizeof(T) <= data.size())
+            memcpy(&value, data.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+    const void *blob(size_t size)
+    {
+        const void *p = data.data() + pos;
+        pos += size;
+        return p;
+    }
+    bool atEnd() const { return pos >= data.size(); }
+};
+
+struct GLTraceState
+{
+    bool active = false;
+    const char *names[GLTRACE_FUNCTION_COUNT] = {};
+    void (*replayers[GLTRACE_FUNCTION_COUNT])(GLTraceReader &) = {};
+
+    uint32_t frameCalls[GLTRACE_FUNCTION_COUNT] = {};
+    double frameNs[GLTRACE_FUNCTION_COUNT] = {};
+    uint64_t totalCalls[GLTRACE_FUNCTION_COUNT] = {};
+    double totalNs[GLTRACE_FUNCTION_COUNT] = {};
+    int frames = 0;
+    uint64_t lastFrameCalls = 0;
+    double lastFrameNs = 0.0;
+
+    FILE *dump = nullptr;
+    FrameArena arena;                   // o "frame" do rastro fecha no glTraceEndFrame
+    FrameVector<unsigned char> record{FrameAllocator<unsigned char>(arena)}; // chamadas do frame
+    std::vector<unsigned char> scratch; // destino dos ponteiros de saída na reprodução
+};
+
+inline GLTraceState glTrace;
+
+inline void glTracePut(const void *p, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)p;
+    glTrace.record.insert(glTrace.record.end(), bytes, bytes + size);
+}
+
+template <typename T> void glTracePutValue(T value) { glTracePut(&value, sizeof(T)); }
+
+// Bytes de uma linha de textura GL_UNSIGNED_BYTE (alinhamento padrão de 4), -1 se não suportado
+inline long glTraceImageBytes(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+    if (type != GL_UNSIGNED_BYTE)
+        return -1;
+    int channels = format == GL_RED ? 1 : format == GL_RG ? 2 : (format == GL_RGB || format == GL_BGR) ? 3
+                 : (format == GL_RGBA || format == GL_BGRA) ? 4 : 0;
+    if (channels == 0)
+        return -1;
+    long row = (long(width) * channels + 3) & ~3L;
+    return row * height;
+}
+
+#define GLTRACE_IS(name) (ID == GLTRACE_ID_##name)
+
+// Tamanho do conteúdo apontado pelo argumento I da função ID, ou -1 se desconhecido
+template <int ID, size_t I, typename Tuple> long glTracePointerBytes(const Tuple &a)
+{
+    if constexpr (GLTRACE_IS(glBufferData) && I == 2)
+        return long(std::get<1>(a));
+    else if constexpr (GLTRACE_IS(glBufferSubData) && I == 3)
+        return long(std::get<2>(a));
+    else if constexpr ((GLTRACE_IS(glUniform1fv) || GLTRACE_IS(glUniform1iv) || GLTRACE_IS(glUniform1uiv)) && I == 2)
+        return long(std::get<1>(a)) * 4;
+    else if constexpr ((GLTRACE_IS(glUniform2fv) || GLTRACE_IS(glUniform2iv) || GLTRACE_IS(glUniform2uiv)) && I == 2)
+        return long(std::get<1>(a)) * 8;
+    else if constexpr ((GLTRACE_IS(glUniform3fv) || GLTRACE_IS(glUniform3iv) || GLTRACE_IS(glUniform3uiv)) && I == 2)
+        return long(std::get<1>(a)) * 12;
+    else if constexpr ((GLTRACE_IS(glUniform4fv) || GLTRACE_IS(glUniform4iv) || GLTRACE_IS(glUniform4uiv)) && I == 2)
+        return long(std::get<1>(a)) * 16;
+    else if constexpr (GLTRACE_IS(glUniformMatrix2fv) && I == 3)
+        return long(std::get<1>(a)) * 16;
+    else if constexpr (GLTRACE_IS(glUniformMatrix3fv) && I == 3)
+        return long(std::get<1>(a)) * 36;
+    else if constexpr (GLTRACE_IS(glUniformMatrix4fv) && I == 3)
+        return long(std::get<1>(a)) * 64;
+    else if constexpr ((GLTRACE_IS(glGetUniformLocation) || GLTRACE_IS(glGetAttribLocation) ||
+                        GLTRACE_IS(glGetUniformBlockIndex)) && I == 1)
+        return std::get<1>(a) ? long(strlen(std::get<1>(a)) + 1) : -1;
+    else if constexpr ((GLTRACE_IS(glBindAttribLocation) || GLTRACE_IS(glBindFragDataLocation)) && I == 2)
+        return std::get<2>(a) ? long(strlen(std::get<2>(a)) + 1) : -1;
+    else if constexpr ((GLTRACE_IS(glDeleteBuffers) || GLTRACE_IS(glDeleteVertexArrays) || GLTRACE_IS(glDeleteTextures) ||
+                        GLTRACE_IS(glDeleteFramebuffers) || GLTRACE_IS(glDeleteRenderbuffers) ||
+                        GLTRACE_IS(glDeleteQueries) || GLTRACE_IS(glDeleteSamplers) ||
+                        GLTRACE_IS(glDeleteTransformFeedbacks) || GLTRACE_IS(glDrawBuffers)) && I == 1)
+        return long(std::get<0>(a)) * 4;
+    else if constexpr (GLTRACE_IS(glTexImage2D) && I == 8)
+        return glTraceImageBytes(std::get<3>(a), std::get<4>(a), std::get<6>(a), std::get<7>(a));
+    else if constexpr (GLTRACE_IS(glTexSubImage2D) && I == 8)
+        return glTraceImageBytes(std::get<4>(a), std::get<5>(a), std::get<6>(a), std::get<7>(a));
+    else
+        return -1;
+}
+
+// Ponteiro para tipo numérico (ou void) não-const: a função escreve nele
+template <typename T> constexpr bool glTraceIsOutput()
+{
+    using Pointee = std::remove_pointer_t<T>;
+    return !std::is_const_v<Pointee> && (std::is_arithmetic_v<Pointee> || std::is_void_v<Pointee>);
+}
+
+// Ponteiros: 0 = valor (deslocamento), 1 = conteúdo copiado, 2 = saída
+template <int ID, size_t I, typename Tuple> void glTraceWriteArg(const Tuple &args)
+{
+    using T = std::tuple_element_t<I, Tuple>;
+    const T &value = std::get<I>(args);
+    if constexpr (std::is_pointer_v<T>) {
+        long bytes = glTracePointerBytes<ID, I>(args);
+        if (bytes >= 0 && value) {
+            glTracePutValue<uint8_t>(1);
+            glTracePutValue<uint32_t>(uint32_t(bytes));
+            glTracePut((const void *)value, size_t(bytes));
+        } else if constexpr (glTraceIsOutput<T>()) {
+            glTracePutValue<uint8_t>(2);
+        } else {
+            glTracePutValue<uint8_t>(0);
+            glTracePutValue<uint64_t>(uint64_t(uintptr_t(value)));
+        }
+    } else {
+        glTracePut(&value, sizeof(T));
+    }
+}
+
+template <int ID, size_t I, typename Tuple> void glTraceReadArg(GLTraceReader &reader, Tuple &args)
+{
+    using T = std::tuple_element_t<I, Tuple>;
+    if constexpr (std::is_pointer_v<T>) {
+        uint8_t kind = reader.read<uint8_t>();
+        if (kind == 1) {
+            uint32_t bytes = reader.read<uint32_t>();
+            std::get<I>(args) = (T)reader.blob(bytes);
+        } else if (kind == 2) {
+            std::get<I>(args) = (T)glTrace.scratch.data();
+        } else {
+            std::get<I>(args) = (T)uintptr_t(reader.read<uint64_t>());
+        }
+    } else {
+        std::get<I>(args) = reader.read<T>();
+    }
+}
+
+// glShaderSource junta as strings em uma só (count = 1 na reprodução)
+template <int ID, typename Tuple, size_t... I> void glTraceWriteCall(const Tuple &args, std::index_sequence<I...>)
+{
+    size_t start = glTrace.record.size();
+    glTracePutValue<uint16_t>(uint16_t(ID));
+    glTracePutValue<uint32_t>(0); // tamanho, preenchido abaixo
+    if constexpr (GLTRACE_IS(glShaderSource)) {
+        const GLint *lengths = std::get<3>(args);
+        auto length = [&](GLsizei i) {
+            return lengths && lengths[i] >= 0 ? size_t(lengths[i]) : strlen(std::get<2>(args)[i]);
+        };
+        size_t total = 0;
+        for (GLsizei i = 0; i < std::get<1>(args); ++i)
+            total += length(i);
+        glTracePutValue<GLuint>(std::get<0>(args));
+        glTracePutValue<uint32_t>(uint32_t(total + 1));
+        for (GLsizei i = 0; i < std::get<1>(args); ++i)
+            glTracePut(std::get<2>(args)[i], length(i));
+        glTracePutValue<char>('\0');
+    } else {
+        (glTraceWriteArg<ID, I>(args), ...);
+    }
+    uint32_t payload = uint32_t(glTrace.record.size() - start - 6);
+    memcpy(glTrace.record.data() + start + 2, &payload, sizeof(payload));
+}
+
+// Escreve as chamadas gravadas e recomeça a arena, já com o tamanho do frame que acabou
+inline void glTraceFlush()
+{
+    if (!glTrace.dump)
+        return;
+    fwrite(glTrace.record.data(), 1, glTrace.record.size(), glTrace.dump);
+    size_t bytes = glTrace.record.size();
+    glTrace.record = FrameVector<unsigned char>(FrameAllocator<unsigned char>(glTrace.arena));
+    frameArenaReset(glTrace.arena);
+    glTrace.record.reserve(bytes);
+}
+
+template <int ID, typename F> struct GLTraceThunk;
+
+template <int ID, typename R, typename... Args> struct GLTraceThunk<ID, R(APIENTRYP)(Args...)>
+{
+    static inline R(APIENTRYP original)(Args...) = nullptr;
+
+    static R APIENTRY call(Args... args)
+    {
+        if (glTrace.dump)
+            glTraceWriteCall<ID>(std::tuple<Args...>(args...), std::index_sequence_for<Args...>());
+        auto start = std::chrono::steady_clock::now();
+        if constexpr (std::is_void_v<R>) {
+            original(args...);
+            count(start);
+        } else {
+            R result = original(args...);
+            count(start);
+            return result;
+        }
+    }
+
+    static void count(std::chrono::steady_clock::time_point start)
+    {
+        glTrace.frameCalls[ID]++;
+        glTrace.frameNs[ID] += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Reproduz passando pelo wrapper, para que a reprodução também gere estatísticas
+    static void replay(GLTraceReader &reader)
+    {
+        if constexpr (GLTRACE_IS(glShaderSource)) {
+            GLuint shader = reader.read<GLuint>();
+            uint32_t bytes = reader.read<uint32_t>();
+            const GLchar *source = (const GLchar *)reader.blob(bytes);
+            call(shader, 1, &source, nullptr);
+        } else {
+            std::tuple<Args...> args;
+            readArgs(reader, args, std::index_sequence_for<Args...>());
+            std::apply(call, args);
+        }
+    }
+
+    template <size_t... I> static void readArgs(GLTraceReader &reader, std::tuple<Args...> &args, std::index_sequence<I...>)
+    {
+        (glTraceReadArg<ID, I>(reader, args), ...);
+    }
+};
+
+#undef GLTRACE_IS
+
+template <int ID, typename F> void glTraceInstallOne(F &pointer, const char *name)
+{
+    glTrace.names[ID] = name;
+    glTrace.replayers[ID] = &GLTraceThunk<ID, F>::replay;
+    if (pointer && pointer != &GLTraceThunk<ID, F>::call) {
+        GLTraceThunk<ID, F>::original = pointer;
+        pointer = &GLTraceThunk<ID, F>::call;
+    }
+}
+
+// Troca os ponteiros já carregados pelo glad pelos wrappers (chamar depois do gladLoadGLLoader)
+inline void glTraceInstall()
+{
+#define GL_TRACE_FUNCTION(name) glTraceInstallOne<GLTRACE_ID_##name>(glad_##name, #name);
+#include "gl_trace_functions.h"
+#undef GL_TRACE_FUNCTION
+    glTrace.active = true;
+}
+
+template <int ID, typename F> void glTraceRemoveOne(F &pointer)
+{
+    if (pointer == &GLTraceThunk<ID, F>::call)
+        pointer = GLTraceThunk<ID, F>::original;
+}
+
+// Devolve os ponteiros originais (para medir tempo sem o custo dos wrappers); as estatísticas
+// acumuladas continuam disponíveis
+inline void glTraceRemove()
+{
+#define GL_TRACE_FUNCTION(name) glTraceRemoveOne<GLTRACE_ID_##name>(glad_##name);
+#include "gl_trace_functions.h"
+#undef GL_TRACE_FUNCTION
+}
+
+// Começa a gravar o rastro binário: cabeçalho com a tabela de nomes das funções
+inline bool glTraceOpenDump(const char *path)
+{
+    glTrace.dump = fopen(path, "wb");
+    if (!glTrace.dump) {
+        fprintf(stderr, "gl_trace: não foi possível criar %s\n", path);
+        return false;
+    }
+    fwrite(GLTRACE_MAGIC, 1, sizeof(GLTRACE_MAGIC), glTrace.dump);
+    uint32_t count = GLTRACE_FUNCTION_COUNT;
+    fwrite(&count, sizeof(count), 1, glTrace.dump);
+    for (int i = 0; i < GLTRACE_FUNCTION_COUNT; ++i) {
+        uint16_t length = uint16_t(strlen(glTrace.names[i]));
+        fwrite(&length, sizeof(length), 1, glTrace.dump);
+        fwrite(glTrace.names[i], 1, length, glTrace.dump);
+    }
+    return true;
+}
+
+// GL_TRACE=1 liga as estatísticas; GL_TRACE_FILE=caminho também grava o rastro
+inline bool glTraceInitFromEnv()
+{
+    const char *file = getenv("GL_TRACE_FILE");
+    const char *trace = getenv("GL_TRACE");
+    if (!file && !(trace && trace[0] != '0'))
+        return false;
+    glTraceInstall();
+    if (file)
+        glTraceOpenDump(file);
+    return true;
+}
+
+// Fecha o frame: acumula as estatísticas e grava o marcador de frame no rastro
+inline void glTraceEndFrame()
+{
+    if (!glTrace.active)
+        return;
+    glTrace.lastFrameCalls = 0;
+    glTrace.lastFrameNs = 0.0;
+    for (int i = 0; i < GLTRACE_FUNCTION_COUNT; ++i) {
+        glTrace.lastFrameCalls += glTrace.frameCalls[i];
+        glTrace.lastFrameNs += glTrace.frameNs[i];
+        glTrace.totalCalls[i] += glTrace.frameCalls[i];
+        glTrace.totalNs[i] += glTrace.frameNs[i];
+        glTrace.frameCalls[i] = 0;
+        glTrace.frameNs[i] = 0.0;
+    }
+    glTrace.frames++;
+    if (glTrace.dump) {
+        glTracePutValue<uint16_t>(GLTRACE_FRAME_MARKER);
+        glTracePutValue<uint32_t>(0);
+        glTraceFlush();
+    }
+}
+
+// Tabela das funções mais chamadas: chamadas e tempo no driver por frame
+inline void glTraceReport(FILE *out, int maxRows = 20)
+{
+    if (!glTrace.active || glTrace.frames == 0)
+        return;
+    std::vector<int> ids;
+    uint64_t calls = 0;
+    double ns = 0.0;
+    for (int i = 0; i < GLTRACE_FUNCTION_COUNT; ++i) {
+        calls += glTrace.totalCalls[i];
+        ns += glTrace.totalNs[i];
+        if (glTrace.totalCalls[i] > 0)
+            ids.push_back(i);
+    }
+    std::sort(ids.begin(), ids.end(), [](int a, int b) { return glTrace.totalCalls[a] > glTrace.totalCalls[b]; });
+    double frames = glTrace.frames;
+    fprintf(out, "gl_trace: %d frames, %.1f chamadas/frame, %.3f ms/frame no driver\n", glTrace.frames,
+            calls / frames, ns / frames / 1e6);
+    fprintf(out, "  %-32s %14s %14s\n", "função", "chamadas/frame", "us/frame");
+    for (size_t i = 0; i < ids.size() && int(i) < maxRows; ++i)
+        fprintf(out, "  %-32s %14.1f %14.2f\n", glTrace.names[ids[i]], glTrace.totalCalls[ids[i]] / frames,
+                glTrace.totalNs[ids[i]] / frames / 1e3);
+}
+
+inline void glTraceShutdown()
+{
+    glTraceReport(stderr);
+    glTraceFlush(); // chamadas depois do último frame
+    if (glTrace.dump)
+        fclose(glTrace.dump);
+    glTrace.dump = nullptr;
+}
+
+// Carrega um rastro gravado; os wrappers precisam estar instalados (glTraceInstall)
+inline bool glTraceReplayOpen(const char *path, GLTraceReader &reader)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    reader.data.resize(size_t(ftell(f)));
+    fseek(f, 0, SEEK_SET);
+    size_t got = fread(reader.data.data(), 1, reader.data.size(), f);
+    fclose(f);
+    if (got != reader.data.size() || reader.data.size() < sizeof(GLTRACE_MAGIC) + 4 ||
+        memcmp(reader.data.data(), GLTRACE_MAGIC, sizeof(GLTRACE_MAGIC)) != 0)
+        return false;
+
+    // As funções são casadas pelo nome, então rastros de outra versão da lista continuam válidos
+    reader.pos = sizeof(GLTRACE_MAGIC);
+    uint32_t count = reader.read<uint32_t>();
+    reader.localIds.assign(count, -1);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint16_t length = reader.read<uint16_t>();
+        std::string name((const char *)reader.blob(length), length);
+        for (int id = 0; id < GLTRACE_FUNCTION_COUNT; ++id)
+            if (glTrace.names[id] && name == glTrace.names[id])
+                reader.localIds[i] = id;
+    }
+    glTrace.scratch.assign(16 << 20, 0);
+    return true;
+}
+
+// Executa as chamadas de um frame; retorna false quando o rastro acaba
+inline bool glTraceReplayFrame(GLTraceReader &reader)
+{
+    while (!reader.atEnd()) {
+        uint16_t fileId = reader.read<uint16_t>();
+        uint32_t payload = reader.read<uint32_t>();
+        if (fileId == GLTRACE_FRAME_MARKER)
+            return true;
+        size_t next = reader.pos + payload;
+        int id = fileId < reader.localIds.size() ? reader.localIds[fileId] : -1;
+        if (id >= 0 && glTrace.replayers[id] && *glTrace.names[id])
+            glTrace.replayers[id](reader);
+        reader.pos = next;
+    }
+    return false;
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+// Gravação e reprodução determinística da entrada do GLFW (cliques, teclas e cursor), para
+// medir o tempo de frame dos exercícios interativos de forma repetível.
+//
+// Uso em um programa (depois de registrar os callbacks dele):
+//   inputWindowHints();                 // antes do glfwCreateWindow: janela oculta em INPUT_HEADLESS=1
+//   inputInit(window);                  // lê as variáveis de ambiente abaixo
+//   inputPollEvents(window);            // no lugar do glfwPollEvents, uma vez por frame
+//   inputCursorPos(window, &x, &y);     // no lugar do glfwGetCursorPos dentro dos callbacks
+//   inputShutdown();                    // fecha a gravação / imprime os tempos de frame
+//
+// INPUT_RECORD=arquivo  grava os eventos com o número do frame em que chegaram
+// INPUT_REPLAY=arquivo  reproduz a gravação (a entrada real é ignorada) e fecha no fim
+// INPUT_SYNTH=cliques:N gera N cliques por segundo em posições aleatórias (semente fixa),
+//                       a 60 frames por segundo simulados, por INPUT_FRAMES frames (600)
+// Na reprodução os eventos são entregues por frame e não por tempo de relógio, então a mesma
+// gravação gera a mesma sequência de chamadas em qualquer máquina.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <GLFW/glfw3.h>
+
+enum InputEventType : uint8_t
+{
+    INPUT_MOUSE_BUTTON = 0,
+    INPUT_KEY,
+    INPUT_CURSOR,
+    INPUT_END // último frame da gravação
+};
+
+// Registro de 20 bytes gravado como está no arquivo
+struct InputEvent
+{
+    uint32_t frame;
+    uint8_t type;
+    uint8_t action;
+    uint16_t mods;
+    int32_t code; // botão ou tecla
+    float x, y;   // posição do cursor no momento do evento
+};
+static_assert(sizeof(InputEvent) == 20, "InputEvent deve ter 20 bytes");
+
+constexpr char INPUT_MAGIC[8] = {'G', 'L', 'F', 'W', 'I', 'N', 'P', '1'};
+constexpr double INPUT_SYNTH_DT = 1.0 / 60.0;
+constexpr size_t INPUT_FRAME_SAMPLES = 1 << 16; // tempos de frame guardados (os mais recentes)
+
+enum InputMode
+{
+    INPUT_LIVE = 0,
+    INPUT_RECORDING,
+    INPUT_REPLAYING
+};
+
+struct InputState
+{
+    InputMode mode = INPUT_LIVE;
+    GLFWmousebuttonfun mouseButton = nullptr;
+    GLFWkeyfun key = nullptr;
+    GLFWcursorposfun cursor = nullptr;
+    FILE *record = nullptr;
+
+    std::vector<InputEvent> events; // reprodução (ou gerados)
+    size_t next = 0;
+    uint32_t lastFrame = 0;
+    double cursorX = 0.0, cursorY = 0.0;
+
+    uint32_t frame = 0;
+    double frameStart = 0.0;
+    std::vector<float> frameMs; // circular: reservado no inputInit, nunca passa de INPUT_FRAME_SAMPLES
+};
+
+inline InputState inputState;
+
+inline bool inputHeadless()
+{
+    const char *e = getenv("INPUT_HEADLESS");
+    return e && e[0] == '1';
+}
+
+inline void inputWindowHints()
+{
+    if (inputHeadless())
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+}
+
+inline void inputWrite(uint8_t type, int code, int action, int mods, double x, double y)
+{
+    InputEvent e{inputState.frame, type, uint8_t(action), uint16_t(mods), code, float(x), float(y)};
+    fwrite(&e, sizeof(e), 1, inputState.record);
+}
+
+// Callbacks instalados no GLFW: gravam e repassam ao programa, ou descartam a entrada real
+// durante a reprodução
+inline void inputMouseButtonHook(GLFWwindow *window, int button, int action, int mods)
+{
+    if (inputState.mode == INPUT_REPLAYING)
+        return;
+    glfwGetCursorPos(window, &inputState.cursorX, &inputState.cursorY);
+    if (inputState.record)
+        inputWrite(INPUT_MOUSE_BUTTON, button, action, mods, inputState.cursorX, inputState.cursorY);
+    if (inputState.mouseButton)
+        inputState.mouseButton(window, button, action, mods);
+}
+
+inline void inputKeyHook(GLFWwindow *window, int key, int scancode, int action, int mods)
+{
+    if (inputState.mode == INPUT_REPLAYING)
+        return;
+    if (inputState.record)
+        inputWrite(INPUT_KEY, key, action, mods, inputState.cursorX, inputState.cursorY);
+    if (inputState.key)
+        inputState.key(window, key, scancode, action, mods);
+}
+
+inline void inputCursorHook(GLFWwindow *window, double x, double y)
+{
+    if (inputState.mode == INPUT_REPLAYING)
+        return;
+    inputState.cursorX = x;
+    inputState.cursorY = y;
+    if (inputState.record)
+        inputWrite(INPUT_CURSOR, 0, 0, 0, x, y);
+    if (inputState.cursor)
+        inputState.cursor(window, x, y);
+}
+
+// Posição do cursor: a do evento reproduzido, ou a real
+inline void inputCursorPos(GLFWwindow *window, double *x, double *y)
+{
+    if (inputState.mode == INPUT_REPLAYING) {
+        *x = inputState.cursorX;
+        *y = inputState.cursorY;
+        return;
+    }
+    glfwGetCursorPos(window, x, y);
+}
+
+inline bool inputLoad(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "input: não foi possível abrir %s\n", path);
+        return false;
+    }
+    char magic[sizeof(INPUT_MAGIC)];
+    if (fread(magic, 1, sizeof(magic), f) != sizeof(magic) || memcmp(magic, INPUT_MAGIC, sizeof(magic)) != 0) {
+        fprintf(stderr, "input: %s não é uma gravação de entrada\n", path);
+        fclose(f);
+        return false;
+    }
+    InputEvent e;
+    while (fread(&e, sizeof(e), 1, f) == 1)
+        inputState.events.push_back(e);
+    fclose(f);
+    return true;
+}
+
+// Cliques esquerdos (pressiona e solta) em posições uniformes na janela
+inline void inputSynthesizeClicks(GLFWwindow *window, double clicksPerSecond, uint32_t frames)
+{
+    int width, height;
+    glfwGetWindowSize(window, &width, &height);
+    std::mt19937 rng{1234};
+    std::uniform_real_distribution<float> px(0.0f, float(width)), py(0.0f, float(height));
+    double pending = 0.0;
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        pending += clicksPerSecond * INPUT_SYNTH_DT;
+        for (; pending >= 1.0; pending -= 1.0) {
+            float x = px(rng), y = py(rng);
+            inputState.events.push_back({frame, INPUT_MOUSE_BUTTON, GLFW_PRESS, 0, GLFW_MOUSE_BUTTON_LEFT, x, y});
+            inputState.events.push_back({frame, INPUT_MOUSE_BUTTON, GLFW_RELEASE, 0, GLFW_MOUSE_BUTTON_LEFT, x, y});
+        }
+    }
+    inputState.events.push_back({frames, INPUT_END, 0, 0, 0, 0.0f, 0.0f});
+}
+
+// Instala os ganchos sobre os callbacks já registrados e escolhe o modo pelo ambiente
+inline InputMode inputInit(GLFWwindow *window)
+{
+    inputState.mouseButton = glfwSetMouseButtonCallback(window, inputMouseButtonHook);
+    inputState.key = glfwSetKeyCallback(window, inputKeyHook);
+    inputState.cursor = glfwSetCursorPosCallback(window, inputCursorHook);
+
+    const char *record = getenv("INPUT_RECORD");
+    const char *replay = getenv("INPUT_REPLAY");
+    const char *synth = getenv("INPUT_SYNTH");
+    const char *frames = getenv("INPUT_FRAMES");
+    double clicksPerSecond = 0.0;
+    if (replay && inputLoad(replay)) {
+        inputState.mode = INPUT_REPLAYING;
+    } else if (synth && sscanf(synth, "cliques:%lf", &clicksPerSecond) == 1) {
+        inputSynthesizeClicks(window, clicksPerSecond, frames ? uint32_t(atoi(frames)) : 600);
+        inputState.mode = INPUT_REPLAYING;
+    } else if (record) {
+        inputState.record = fopen(record, "wb");
+        if (inputState.record) {
+            fwrite(INPUT_MAGIC, 1, sizeof(INPUT_MAGIC), inputState.record);
+            inputState.mode = INPUT_RECORDING;
+        }
+    }
+    if (inputState.mode == INPUT_REPLAYING) {
+        // Sem INPUT_END (gravação interrompida), termina no frame do último evento
+        inputState.lastFrame = inputState.events.empty() ? 0 : inputState.events.back().frame;
+    }
+    inputState.frameMs.reserve(INPUT_FRAME_SAMPLES);
+    inputState.frameStart = glfwGetTime();
+    return inputState.mode;
+}
+
+// Entrega os eventos reproduzidos do frame atual aos callbacks do programa
+inline void inputDeliver(GLFWwindow *window)
+{
+    while (inputState.next < inputState.events.size() && inputState.events[inputState.next].frame <= inputState.frame) {
+        const InputEvent &e = inputState.events[inputState.next++];
+        inputState.cursorX = e.x;
+        inputState.cursorY = e.y;
+        switch (e.type) {
+        case INPUT_MOUSE_BUTTON:
+            if (inputState.mouseButton)
+                inputState.mouseButton(window, e.code, e.action, e.mods);
+            break;
+        case INPUT_KEY:
+            if (inputState.key)
+                inputState.key(window, e.code, 0, e.action, e.mods);
+            break;
+        case INPUT_CURSOR:
+            if (inputState.cursor)
+                inputState.cursor(window, e.x, e.y);
+            break;
+        }
+    }
+    if (inputState.frame >= inputState.lastFrame)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+}
+
+// Um frame de entrada: mede o tempo desde a chamada anterior e processa os eventos. Com
+// waitSeconds > 0 espera até esse tempo por um evento (glfwWaitEventsTimeout) em vez de só olhar.
+inline void inputPollEvents(GLFWwindow *window, double waitSeconds = 0.0)
+{
+    double now = glfwGetTime();
+    if (inputState.frame > 0) {
+        float ms = float(1000.0 * (now - inputState.frameStart));
+        if (inputState.frameMs.size() < INPUT_FRAME_SAMPLES)
+            inputState.frameMs.push_back(ms);
+        else
+            inputState.frameMs[(inputState.frame - 1) % INPUT_FRAME_SAMPLES] = ms;
+    }
+    inputState.frameStart = now;
+
+    if (waitSeconds > 0.0)
+        glfwWaitEventsTimeout(waitSeconds);
+    else
+        glfwPollEvents();
+    if (inputState.mode == INPUT_REPLAYING)
+        inputDeliver(window);
+    inputState.frame++;
+}
+
+inline float inputPercentile(const std::vector<float> &sorted, float p)
+{
+    return sorted.empty() ? 0.0f : sorted[std::min(sorted.size() - 1, size_t(p * sorted.size()))];
+}
+
+// Fecha a gravação; na reprodução imprime a distribuição dos tempos de frame
+inline void inputShutdown()
+{
+    if (inputState.record) {
+        inputWrite(INPUT_END, 0, 0, 0, 0.0, 0.0);
+        fclose(inputState.record);
+        inputState.record = nullptr;
+    }
+    if (inputState.mode == INPUT_REPLAYING && !inputState.frameMs.empty()) {
+        std::vector<float> sorted = inputState.frameMs;
+        std::sort(sorted.begin(), sorted.end());
+        double total = 0.0;
+        for (float ms : sorted)
+            total += ms;
+        printf("input: %zu frames, média %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, máx %.3f ms\n",
+               sorted.size(), total / sorted.size(), inputPercentile(sorted, 0.50f), inputPercentile(sorted, 0.95f),
+               inputPercentile(sorted, 0.99f), sorted.back());
+    }
+}
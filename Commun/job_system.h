@@ -0,0 +1,221 @@
+#pragma once
+
+// Sistema de jobs com roubo de trabalho, para o trabalho de CPU que hoje roda em série na
+// thread principal (geração de vértices, dados de instância, descarte de formas fora da tela).
+//
+// Cada thread tem a sua fila dupla: a dona empilha e desempilha no fim (o job mais recente
+// ainda está no cache) e as outras roubam do começo (os jobs mais antigos, em geral maiores).
+// Quem espera um grupo de jobs (jobWait) executa jobs enquanto espera, então a thread
+// principal também trabalha e jobs podem esperar outros sem travar o pool.
+//
+//   JobSystem jobs;  jobSystemStart(jobs, 0);               // 0 = um worker por núcleo
+//   JobCounter a, b;
+//   jobSubmit(jobs, [] { ... }, &a);                         // 'a' conta os jobs pendentes
+//   jobSubmit(jobs, [] { ... }, &b, {&a});                   // só começa depois de 'a'
+//   jobParallelFor(jobs, 0, n, 4096, [](size_t i0, size_t i1) { ... });
+//   jobWait(jobs, b);
+//   jobSystemStop(jobs);
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Job;
+
+// Conta os jobs ainda não terminados de um grupo e guarda os jobs que dependem dele.
+// Todos os jobs de um grupo devem ser enviados antes dos jobs que dependem dele, e o contador
+// só pode ser destruído depois do jobWait.
+struct JobCounter
+{
+    std::atomic<int> pending{0};
+    std::mutex mutex;
+    std::vector<Job *> waiting;
+};
+
+struct Job
+{
+    std::function<void()> work;
+    JobCounter *counter = nullptr;
+    std::atomic<int> dependencies{0}; // grupos que ainda precisam terminar
+};
+
+struct JobWorker
+{
+    std::mutex mutex;
+    std::deque<Job *> queue;
+};
+
+struct JobSystem
+{
+    std::vector<std::thread> threads;
+    std::vector<JobWorker *> workers; // workers[0] é a thread que criou o sistema
+    std::atomic<bool> stop{false};
+    std::atomic<int> queued{0}; // jobs prontos nas filas
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<long long> steals{0};
+};
+
+// Índice da fila da thread atual (-1 fora do sistema: usa a fila 0)
+inline thread_local int jobWorkerIndex = -1;
+
+inline void jobPush(JobSystem &js, Job *job)
+{
+    JobWorker *worker = js.workers[jobWorkerIndex < 0 ? 0 : jobWorkerIndex];
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->queue.push_back(job);
+    }
+    js.queued.fetch_add(1, std::memory_order_release);
+    js.wake.notify_one();
+}
+
+// Um job da própria fila (o mais novo) ou roubado de outra (o mais antigo)
+inline Job *jobTake(JobSystem &js)
+{
+    int self = jobWorkerIndex < 0 ? 0 : jobWorkerIndex;
+    int count = int(js.workers.size());
+    for (int k = 0; k < count; ++k) {
+        int index = (self + k) % count;
+        JobWorker *worker = js.workers[index];
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (worker->queue.empty())
+            continue;
+        Job *job;
+        if (k == 0) {
+            job = worker->queue.back();
+            worker->queue.pop_back();
+        } else {
+            job = worker->queue.front();
+            worker->queue.pop_front();
+            js.steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        js.queued.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+    return nullptr;
+}
+
+inline void jobRelease(JobSystem &js, Job *job);
+
+inline void jobExecute(JobSystem &js, Job *job)
+{
+    job->work();
+    JobCounter *counter = job->counter;
+    delete job;
+    if (!counter)
+        return;
+    // O último job do grupo libera os que dependiam dele
+    std::vector<Job *> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        ready.swap(counter->waiting);
+    }
+    for (Job *next : ready)
+        jobRelease(js, next);
+}
+
+// Uma dependência a menos; sem nenhuma, o job vai para a fila
+inline void jobRelease(JobSystem &js, Job *job)
+{
+    if (job->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        jobPush(js, job);
+}
+
+inline void jobSubmit(JobSystem &js, std::function<void()> work, JobCounter *counter = nullptr,
+                      std::initializer_list<JobCounter *> after = {})
+{
+    Job *job = new Job;
+    job->work = std::move(work);
+    job->counter = counter;
+    if (counter)
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    // Uma dependência extra enquanto as reais são registradas, para não soltar o job no meio
+    job->dependencies.store(int(after.size()) + 1, std::memory_order_relaxed);
+    for (JobCounter *dependency : after) {
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (dependency->pending.load(std::memory_order_acquire) == 0)
+            job->dependencies.fetch_sub(1, std::memory_order_relaxed);
+        else
+            dependency->waiting.push_back(job);
+    }
+    jobRelease(js, job);
+}
+
+// Espera o grupo terminar executando jobs nesse meio tempo
+inline void jobWait(JobSystem &js, JobCounter &counter)
+{
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        if (Job *job = jobTake(js))
+            jobExecute(js, job);
+        else
+            std::this_thread::yield();
+    }
+    // O último job zera 'pending' ainda com o mutex: passar por ele garante que o worker já
+    // soltou o contador, e quem chamou pode destruí-lo logo depois
+    std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+inline void jobWorkerLoop(JobSystem &js, int index)
+{
+    jobWorkerIndex = index;
+    while (!js.stop.load(std::memory_order_acquire)) {
+        if (Job *job = jobTake(js)) {
+            jobExecute(js, job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(js.sleepMutex);
+        js.wake.wait_for(lock, std::chrono::milliseconds(1), [&] {
+            return js.stop.load(std::memory_order_acquire) || js.queued.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+// threads = total de threads trabalhando, contando a que chama (0 = número de núcleos)
+inline void jobSystemStart(JobSystem &js, int threads)
+{
+    if (threads <= 0)
+        threads = std::max(1, int(std::thread::hardware_concurrency()));
+    js.stop = false;
+    for (int i = 0; i < threads; ++i)
+        js.workers.push_back(new JobWorker);
+    jobWorkerIndex = 0;
+    for (int i = 1; i < threads; ++i)
+        js.threads.emplace_back(jobWorkerLoop, std::ref(js), i);
+}
+
+inline void jobSystemStop(JobSystem &js)
+{
+    js.stop = true;
+    js.wake.notify_all();
+    for (std::thread &t : js.threads)
+        t.join();
+    js.threads.clear();
+    for (JobWorker *worker : js.workers)
+        delete worker;
+    js.workers.clear();
+    jobWorkerIndex = -1;
+}
+
+// Divide [begin, end) em blocos de até 'grain' índices, um job por bloco, e espera todos
+inline void jobParallelFor(JobSystem &js, size_t begin, size_t end, size_t grain,
+                           const std::function<void(size_t, size_t)> &body)
+{
+    JobCounter counter;
+    grain = std::max<size_t>(1, grain);
+    for (size_t first = begin; first < end; first += grain) {
+        size_t last = std::min(end, first + grain);
+        jobSubmit(js, [&body, first, last] { body(first, last); }, &counter);
+    }
+    jobWait(js, counter);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// Nível de detalhe (LOD) para círculos e arcos: a escolha de segmentos está no lod_math.h.
+// As malhas de círculo unitário são pré-calculadas por faixa (8, 16, ..., 256 segmentos)
+// em um único VBO compartilhado por todas as formas.
+
+#include <cmath>
+#include <vector>
+#include <glad/glad.h>
+#include "lod_math.h"
+
+// Malhas de círculo unitário (TRIANGLE_FAN) de todas as faixas em um único VBO
+struct CircleLODMesh
+{
+    GLuint VAO = 0, VBO = 0;
+    GLint first[LOD_BUCKETS];
+    GLsizei count[LOD_BUCKETS];
+};
+
+inline CircleLODMesh createCircleLODMesh()
+{
+    CircleLODMesh mesh;
+    std::vector<float> vertices;
+    for (int b = 0; b < LOD_BUCKETS; ++b) {
+        int n = lodBucketSegments(b);
+        mesh.first[b] = GLint(vertices.size() / 3);
+        mesh.count[b] = n + 2;
+        // Centro + n + 1 pontos da borda (o último fecha o leque)
+        vertices.insert(vertices.end(), {0.0f, 0.0f, 0.0f});
+        for (int i = 0; i <= n; ++i) {
+            float theta = 2.0f * LOD_PI * float(i) / float(n);
+            vertices.insert(vertices.end(), {cosf(theta), sinf(theta), 0.0f});
+        }
+    }
+
+    glGenVertexArrays(1, &mesh.VAO);
+    glGenBuffers(1, &mesh.VBO);
+    glBindVertexArray(mesh.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return mesh;
+}
+
+inline void deleteCircleLODMesh(CircleLODMesh &mesh)
+{
+    glDeleteVertexArrays(1, &mesh.VAO);
+    glDeleteBuffers(1, &mesh.VBO);
+    mesh.VAO = mesh.VBO = 0;
+}
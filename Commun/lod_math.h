@@ -0,0 +1,36 @@
+#pragma once
+
+// Nível de detalhe (LOD) para círculos e arcos, só a conta (sem OpenGL, serve também para o
+// RasterizadorCPU). O número de segmentos é escolhido pelo raio projetado na tela (em pixels)
+// e pelo erro máximo tolerado entre a corda e o arco (sagitta): e = r * (1 - cos(theta / 2)).
+
+#include <cmath>
+
+constexpr float LOD_PI = 3.14159265f;
+constexpr float LOD_MAX_ERROR_PX = 0.5f; // erro máximo padrão da corda, em pixels
+constexpr int LOD_MIN_SEGMENTS = 6;
+constexpr int LOD_MAX_SEGMENTS = 256;
+constexpr int LOD_BUCKETS = 6;           // 8, 16, 32, 64, 128, 256
+
+// Segmentos necessários para um arco de 'arc' radianos com raio 'radiusPx' na tela
+inline int lodSegmentsForRadius(float radiusPx, float maxErrorPx = LOD_MAX_ERROR_PX, float arc = 2.0f * LOD_PI)
+{
+    if (radiusPx <= maxErrorPx)
+        return LOD_MIN_SEGMENTS;
+    float step = 2.0f * acosf(1.0f - maxErrorPx / radiusPx); // maior ângulo por segmento
+    int n = int(ceilf(arc / step));
+    if (n < LOD_MIN_SEGMENTS) n = LOD_MIN_SEGMENTS;
+    if (n > LOD_MAX_SEGMENTS) n = LOD_MAX_SEGMENTS;
+    return n;
+}
+
+// Faixa (bucket) cuja malha tem pelo menos 'segments' segmentos
+inline int lodBucket(int segments)
+{
+    int bucket = 0;
+    while (bucket < LOD_BUCKETS - 1 && (8 << bucket) < segments)
+        ++bucket;
+    return bucket;
+}
+
+inline int lodBucketSegments(int bucket) { return 8 << bucket; }
@@ -0,0 +1,136 @@
+#pragma once
+
+// Marcadores de vértice como point sprites: tamanho, cor e forma (redondo, quadrado,
+// losango) são atributos de cada ponto, então marcadores diferentes saem em uma única
+// chamada GL_POINTS, sem depender do glPointSize global. O fragment shader recorta a
+// forma por gl_PointCoord com anti-aliasing de 1 pixel.
+// Posições em NDC, como nos VBOs das atividades; tamanho (diâmetro) em pixels.
+
+#include <vector>
+#include <glad/glad.h>
+#include "shader.h"
+
+enum MarkerShape
+{
+    MARKER_ROUND = 0,
+    MARKER_SQUARE = 1,
+    MARKER_DIAMOND = 2,
+};
+
+// Um marcador = 2 atributos vec4
+struct Marker
+{
+    float x, y, size, shape;
+    float r, g, b, a;
+};
+
+inline Marker makeMarker(float x, float y, float size, MarkerShape shape, float r, float g, float b)
+{
+    return {x, y, size, float(shape), r, g, b, 1.0f};
+}
+
+inline const char *const markerVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec4 marker;      // posição (NDC), tamanho (px), forma
+layout (location = 1) in vec4 markerColor;
+flat out float vSize;
+flat out int vShape;
+flat out vec4 vColor;
+void main() {
+    vSize = marker.z;
+    vShape = int(marker.w + 0.5);
+    vColor = markerColor;
+    gl_PointSize = marker.z + 2.0;         // 1 pixel extra de cada lado para o anti-aliasing
+    gl_Position = vec4(marker.xy, 0.0, 1.0);
+}
+)";
+
+inline const char *const markerFragmentShaderSource = R"(
+#version 400
+flat in float vSize;
+flat in int vShape;
+flat in vec4 vColor;
+out vec4 color;
+void main() {
+    vec2 p = (gl_PointCoord - 0.5) * (vSize + 2.0);   // pixels a partir do centro
+    float halfSize = 0.5 * vSize;
+    float d;
+    if (vShape == 1)
+        d = max(abs(p.x), abs(p.y)) - halfSize;
+    else if (vShape == 2)
+        d = (abs(p.x) + abs(p.y) - halfSize) * 0.70710678;
+    else
+        d = length(p) - halfSize;
+    float coverage = clamp(0.5 - d, 0.0, 1.0);
+    if (coverage <= 0.0)
+        discard;
+    color = vec4(vColor.rgb, vColor.a * coverage);
+}
+)";
+
+struct MarkerRenderer
+{
+    GLuint program = 0, VAO = 0, VBO = 0;
+    size_t capacity = 0; // marcadores alocados no VBO
+    size_t count = 0;    // marcadores enviados
+};
+
+inline MarkerRenderer createMarkerRenderer()
+{
+    MarkerRenderer markers;
+    markers.program = buildShaderProgram(markerVertexShaderSource, markerFragmentShaderSource);
+    glGenVertexArrays(1, &markers.VAO);
+    glGenBuffers(1, &markers.VBO);
+    glBindVertexArray(markers.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, markers.VBO);
+    for (int i = 0; i < 2; ++i) {
+        glVertexAttribPointer(i, 4, GL_FLOAT, GL_FALSE, sizeof(Marker), (GLvoid *)(i * 4 * sizeof(float)));
+        glEnableVertexAttribArray(i);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return markers;
+}
+
+// Envia os marcadores; o buffer só é realocado quando cresce
+inline void markerUpload(MarkerRenderer &markers, const Marker *data, size_t count)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, markers.VBO);
+    if (count > markers.capacity) {
+        markers.capacity = count;
+        glBufferData(GL_ARRAY_BUFFER, count * sizeof(Marker), data, GL_DYNAMIC_DRAW);
+    } else if (count > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(Marker), data);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    markers.count = count;
+}
+
+inline void markerUpload(MarkerRenderer &markers, const std::vector<Marker> &data)
+{
+    markerUpload(markers, data.data(), data.size());
+}
+
+// Desenha todos os marcadores em uma única chamada
+inline void markerDraw(const MarkerRenderer &markers)
+{
+    if (markers.count == 0)
+        return;
+    glEnable(GL_PROGRAM_POINT_SIZE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glUseProgram(markers.program);
+    glBindVertexArray(markers.VAO);
+    glDrawArrays(GL_POINTS, 0, GLsizei(markers.count));
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+    glDisable(GL_PROGRAM_POINT_SIZE);
+}
+
+inline void deleteMarkerRenderer(MarkerRenderer &markers)
+{
+    glDeleteVertexArrays(1, &markers.VAO);
+    glDeleteBuffers(1, &markers.VBO);
+    glDeleteProgram(markers.program);
+    markers = MarkerRenderer();
+}
@@ -0,0 +1,192 @@
+#pragma once
+
+// Carga de geometria em segundo plano: os vértices são gerados fora da thread principal e
+// enviados à GPU por uma thread de carga com um contexto GL compartilhado com a janela, então a
+// janela aparece logo e o conteúdo vai surgindo conforme fica pronto.
+//
+//   MeshLoader loader;
+//   meshLoaderStart(loader, window);           // na thread principal, depois do GLAD
+//   // em qualquer thread (ex.: jobs do job_system.h):
+//   MeshChunk *chunk = new MeshChunk;  chunk->vertices = ...;  meshLoaderSubmit(loader, chunk);
+//   // a cada frame, na thread principal:
+//   meshLoaderPoll(loader, ready);             // 'ready' recebe os pedaços já na GPU, com VAO
+//   meshLoaderStop(loader);                    // antes de destruir a janela
+//
+// A thread de carga cria o buffer, copia os vértices, cria uma fence e dá glFlush. A thread
+// principal só testa a fence (sem esperar) e, quando ela já passou, cria o VAO no seu contexto
+// (VAOs não são compartilhados entre contextos, buffers sim). Se o contexto compartilhado não
+// puder ser criado, o envio é feito na própria thread principal, até uploadBudget pedaços por
+// chamada do meshLoaderPoll, para não travar o frame.
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+struct MeshChunk
+{
+    int id = 0;
+    std::vector<float> vertices; // liberado depois do envio
+    GLint components = 2;
+    GLsizei count = 0;           // vértices
+    GLuint VBO = 0, VAO = 0;
+    GLsync fence = nullptr;
+};
+
+struct MeshLoader
+{
+    GLFWwindow *context = nullptr; // janela oculta só para o contexto compartilhado
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<MeshChunk *> built;    // vértices prontos na CPU
+    std::deque<MeshChunk *> uploaded; // no buffer, esperando a fence
+    bool stop = false;
+    int uploadBudget = 1; // pedaços por frame no envio pela thread principal
+    std::vector<MeshChunk *> done; // pedaços liberados no meshLoaderPoll, reaproveitado entre frames
+};
+
+// Cria o buffer do pedaço no contexto atual e libera a cópia na CPU
+inline void meshLoaderUpload(MeshChunk *chunk)
+{
+    chunk->count = GLsizei(chunk->vertices.size() / chunk->components);
+    glGenBuffers(1, &chunk->VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, chunk->VBO);
+    glBufferData(GL_ARRAY_BUFFER, chunk->vertices.size() * sizeof(float), chunk->vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    std::vector<float>().swap(chunk->vertices);
+}
+
+inline void meshLoaderThread(MeshLoader &loader)
+{
+    glfwMakeContextCurrent(loader.context);
+    std::unique_lock<std::mutex> lock(loader.mutex);
+    while (true) {
+        loader.wake.wait(lock, [&] { return loader.stop || !loader.built.empty(); });
+        if (loader.stop)
+            break;
+        MeshChunk *chunk = loader.built.front();
+        loader.built.pop_front();
+        lock.unlock();
+
+        meshLoaderUpload(chunk);
+        chunk->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush(); // a fence precisa chegar à GPU para a outra thread vê-la passar
+
+        lock.lock();
+        loader.uploaded.push_back(chunk);
+    }
+    lock.unlock();
+    glfwMakeContextCurrent(nullptr);
+}
+
+// Na thread principal, com o contexto da janela atual. Devolve false se não houver contexto
+// compartilhado (o envio passa a ser feito no meshLoaderPoll).
+inline bool meshLoaderStart(MeshLoader &loader, GLFWwindow *window)
+{
+    // O GLFW não lê dicas de volta: restaura a visibilidade com que a janela principal foi criada
+    // (oculta pelas dicas de CAPTURE_* e INPUT_HEADLESS), para as janelas criadas depois
+    int visible = glfwGetWindowAttrib(window, GLFW_VISIBLE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    loader.context = glfwCreateWindow(1, 1, "carga", nullptr, window); // mesmas dicas de versão
+    glfwWindowHint(GLFW_VISIBLE, visible);
+    if (!loader.context)
+        return false;
+    loader.stop = false;
+    loader.thread = std::thread(meshLoaderThread, std::ref(loader));
+    return true;
+}
+
+// Em qualquer thread: entrega um pedaço com os vértices prontos (o loader passa a ser o dono)
+inline void meshLoaderSubmit(MeshLoader &loader, MeshChunk *chunk)
+{
+    {
+        std::lock_guard<std::mutex> lock(loader.mutex);
+        loader.built.push_back(chunk);
+    }
+    loader.wake.notify_one();
+}
+
+inline void meshLoaderSetupVAO(MeshChunk *chunk)
+{
+    glGenVertexArrays(1, &chunk->VAO);
+    glBindVertexArray(chunk->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, chunk->VBO);
+    glVertexAttribPointer(0, chunk->components, GL_FLOAT, GL_FALSE, chunk->components * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+// Na thread principal, uma vez por frame: acrescenta a 'ready' os pedaços prontos para desenhar.
+// Não espera nada: fence que ainda não passou fica para o próximo frame.
+inline void meshLoaderPoll(MeshLoader &loader, std::vector<MeshChunk *> &ready)
+{
+    std::vector<MeshChunk *> &done = loader.done;
+    done.clear();
+    {
+        std::lock_guard<std::mutex> lock(loader.mutex);
+        if (!loader.context) {
+            for (int i = 0; i < loader.uploadBudget && !loader.built.empty(); ++i) {
+                done.push_back(loader.built.front());
+                loader.built.pop_front();
+            }
+        }
+        while (!loader.uploaded.empty()) {
+            MeshChunk *chunk = loader.uploaded.front();
+            GLenum status = glClientWaitSync(chunk->fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break; // as fences passam em ordem
+            glDeleteSync(chunk->fence);
+            chunk->fence = nullptr;
+            done.push_back(chunk);
+            loader.uploaded.pop_front();
+        }
+    }
+    for (MeshChunk *chunk : done) {
+        if (!chunk->VBO)
+            meshLoaderUpload(chunk);
+        meshLoaderSetupVAO(chunk);
+        ready.push_back(chunk);
+    }
+}
+
+// Quantos pedaços ainda estão a caminho (na fila ou esperando a fence)
+inline size_t meshLoaderPending(MeshLoader &loader)
+{
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    return loader.built.size() + loader.uploaded.size();
+}
+
+inline void deleteMeshChunk(MeshChunk *chunk)
+{
+    if (chunk->fence)
+        glDeleteSync(chunk->fence);
+    glDeleteVertexArrays(1, &chunk->VAO);
+    glDeleteBuffers(1, &chunk->VBO);
+    delete chunk;
+}
+
+// Para a thread de carga e descarta o que não chegou a ficar pronto
+inline void meshLoaderStop(MeshLoader &loader)
+{
+    {
+        std::lock_guard<std::mutex> lock(loader.mutex);
+        loader.stop = true;
+    }
+    loader.wake.notify_all();
+    if (loader.thread.joinable())
+        loader.thread.join();
+    for (MeshChunk *chunk : loader.built)
+        deleteMeshChunk(chunk);
+    for (MeshChunk *chunk : loader.uploaded)
+        deleteMeshChunk(chunk);
+    loader.built.clear();
+    loader.uploaded.clear();
+    if (loader.context)
+        glfwDestroyWindow(loader.context);
+    loader.context = nullptr;
+}
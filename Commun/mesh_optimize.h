@@ -0,0 +1,247 @@
+#pragma once
+
+// Otimização de malhas de triângulos indexadas para a GPU: junta vértices repetidos, reordena
+// os triângulos para aproveitar o cache de vértices já transformados (Tipsify, Sander, Nehab e
+// Barczak 2007) e reordena os vértices na ordem do primeiro uso, para a busca na memória ser
+// sequencial. Índices em 16 bits quando a malha tem até 65536 vértices.
+//
+//   std::vector<unsigned char> vertices = ...;   // 'stride' bytes por vértice
+//   std::vector<uint32_t> indices = ...;         // vazio: sem índices (0, 1, 2, ...)
+//   MeshOptimizeStats stats = meshOptimize(vertices, stride, indices);
+//   printf("ACMR %.3f -> %.3f\n", stats.acmrBefore, stats.acmrAfter);
+//
+// ACMR (average cache miss ratio) é o número de vértices transformados por triângulo, simulando
+// um cache FIFO de MESH_CACHE_SIZE vértices: 3,0 sem reaproveitamento, ~0,5-0,7 numa malha
+// regular bem ordenada. A otimização é feita uma vez, ao gravar a cena (sceneOptimize), e não
+// no sceneUpload, que envia os pedaços mapeados sem copiar.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "scene_file.h"
+
+constexpr int MESH_CACHE_SIZE = 16;
+
+struct MeshOptimizeStats
+{
+    uint32_t verticesBefore = 0, verticesAfter = 0;
+    size_t triangles = 0;
+    float acmrBefore = 0.0f, acmrAfter = 0.0f;
+};
+
+// Vértices transformados por triângulo com um cache FIFO de 'cacheSize' entradas
+inline float meshACMR(const uint32_t *indices, size_t count, uint32_t vertexCount, int cacheSize = MESH_CACHE_SIZE)
+{
+    if (count < 3)
+        return 0.0f;
+    std::vector<uint32_t> cachedAt(vertexCount, 0); // momento em que entrou no cache (0: nunca)
+    uint32_t time = uint32_t(cacheSize) + 1, misses = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t v = indices[i];
+        if (time - cachedAt[v] > uint32_t(cacheSize)) {
+            cachedAt[v] = time++;
+            misses++;
+        }
+    }
+    return float(misses) / float(count / 3);
+}
+
+// Junta vértices com os mesmos bytes; devolve quantos sobraram. 'remap' leva cada vértice
+// antigo ao novo e 'vertices' fica só com os únicos, na ordem do primeiro aparecimento.
+inline uint32_t meshDeduplicate(std::vector<unsigned char> &vertices, uint32_t stride, std::vector<uint32_t> &remap)
+{
+    uint32_t count = uint32_t(vertices.size() / stride);
+    size_t tableSize = 1;
+    while (tableSize < size_t(count) * 2)
+        tableSize <<= 1;
+    std::vector<uint32_t> table(tableSize, UINT32_MAX); // índice do vértice único
+    remap.resize(count);
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        const unsigned char *v = &vertices[size_t(i) * stride];
+        uint64_t hash = 1469598103934665603ull;
+        for (uint32_t b = 0; b < stride; ++b)
+            hash = (hash ^ v[b]) * 1099511628211ull;
+        size_t slot = size_t(hash) & (tableSize - 1);
+        while (table[slot] != UINT32_MAX && memcmp(&vertices[size_t(table[slot]) * stride], v, stride) != 0)
+            slot = (slot + 1) & (tableSize - 1);
+        if (table[slot] == UINT32_MAX) {
+            // Vértice novo: vai para a posição 'unique' (sempre <= i, então não pisa no que falta ler)
+            if (unique != i)
+                memcpy(&vertices[size_t(unique) * stride], v, stride);
+            table[slot] = unique++;
+        }
+        remap[i] = table[slot];
+    }
+    vertices.resize(size_t(unique) * stride);
+    return unique;
+}
+
+// Tipsify: reordena os triângulos para que vértices recentes voltem enquanto ainda estão no
+// cache. Anda em leque em volta de um vértice e escolhe o próximo entre os vizinhos que ainda
+// estarão no cache depois de emitir os triângulos que faltam; sem candidato, volta pela pilha
+// de vértices recentes ou segue pela ordem original. Linear no número de triângulos.
+inline void meshOptimizeVertexCache(uint32_t *destination, const uint32_t *indices, size_t count, uint32_t vertexCount,
+                                    int cacheSize = MESH_CACHE_SIZE)
+{
+    size_t triangles = count / 3;
+    // Triângulos de cada vértice (lista de adjacência compacta)
+    std::vector<uint32_t> live(vertexCount, 0), offsets(size_t(vertexCount) + 1, 0);
+    for (size_t i = 0; i < triangles * 3; ++i)
+        live[indices[i]]++;
+    for (uint32_t v = 0; v < vertexCount; ++v)
+        offsets[v + 1] = offsets[v] + live[v];
+    std::vector<uint32_t> adjacency(triangles * 3), fill(offsets.begin(), offsets.end() - 1);
+    for (size_t t = 0; t < triangles; ++t)
+        for (int k = 0; k < 3; ++k)
+            adjacency[fill[indices[t * 3 + k]]++] = uint32_t(t);
+
+    std::vector<uint32_t> cachedAt(vertexCount, 0);
+    std::vector<char> emitted(triangles, 0);
+    std::vector<uint32_t> deadEnd, candidates;
+    deadEnd.reserve(triangles * 3);
+    uint32_t time = uint32_t(cacheSize) + 1, cursor = 0;
+    size_t out = 0;
+    int64_t fan = triangles ? indices[0] : -1;
+    while (fan >= 0) {
+        candidates.clear();
+        for (uint32_t a = offsets[fan]; a < offsets[fan + 1]; ++a) {
+            uint32_t t = adjacency[a];
+            if (emitted[t])
+                continue;
+            emitted[t] = 1;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = indices[t * 3 + k];
+                destination[out++] = v;
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if (time - cachedAt[v] > uint32_t(cacheSize))
+                    cachedAt[v] = time++;
+            }
+        }
+        // Próximo leque: o vizinho mais antigo no cache que ainda vai estar lá no fim do leque
+        fan = -1;
+        int64_t best = -1;
+        for (uint32_t v : candidates) {
+            if (live[v] == 0)
+                continue;
+            int64_t priority = 0;
+            if (int64_t(time - cachedAt[v]) + 2 * int64_t(live[v]) <= cacheSize)
+                priority = time - cachedAt[v];
+            if (priority > best) {
+                best = priority;
+                fan = v;
+            }
+        }
+        while (fan < 0 && !deadEnd.empty()) {
+            uint32_t v = deadEnd.back();
+            deadEnd.pop_back();
+            if (live[v] > 0)
+                fan = v;
+        }
+        while (fan < 0 && cursor < vertexCount) {
+            if (live[cursor] > 0)
+                fan = cursor;
+            cursor++;
+        }
+    }
+}
+
+// Reordena os vértices na ordem em que os índices os usam pela primeira vez (e descarta os que
+// nenhum triângulo usa); devolve quantos ficaram
+inline uint32_t meshOptimizeVertexFetch(std::vector<unsigned char> &vertices, uint32_t stride, std::vector<uint32_t> &indices)
+{
+    uint32_t count = uint32_t(vertices.size() / stride);
+    std::vector<uint32_t> remap(count, UINT32_MAX);
+    std::vector<unsigned char> ordered(vertices.size());
+    uint32_t next = 0;
+    for (uint32_t &index : indices) {
+        if (remap[index] == UINT32_MAX) {
+            memcpy(&ordered[size_t(next) * stride], &vertices[size_t(index) * stride], stride);
+            remap[index] = next++;
+        }
+        index = remap[index];
+    }
+    ordered.resize(size_t(next) * stride);
+    vertices.swap(ordered);
+    return next;
+}
+
+// As três etapas; 'indices' vazio significa malha sem índices (cada 3 vértices, um triângulo)
+inline MeshOptimizeStats meshOptimize(std::vector<unsigned char> &vertices, uint32_t stride, std::vector<uint32_t> &indices,
+                                      int cacheSize = MESH_CACHE_SIZE)
+{
+    MeshOptimizeStats stats;
+    stats.verticesBefore = uint32_t(vertices.size() / stride);
+    if (indices.empty()) {
+        indices.resize(stats.verticesBefore - stats.verticesBefore % 3);
+        for (size_t i = 0; i < indices.size(); ++i)
+            indices[i] = uint32_t(i);
+    }
+    indices.resize(indices.size() - indices.size() % 3);
+    stats.triangles = indices.size() / 3;
+    stats.acmrBefore = meshACMR(indices.data(), indices.size(), stats.verticesBefore, cacheSize);
+
+    std::vector<uint32_t> remap;
+    uint32_t unique = meshDeduplicate(vertices, stride, remap);
+    for (uint32_t &index : indices)
+        index = remap[index];
+    std::vector<uint32_t> ordered(indices.size());
+    meshOptimizeVertexCache(ordered.data(), indices.data(), indices.size(), unique, cacheSize);
+    indices.swap(ordered);
+    stats.verticesAfter = meshOptimizeVertexFetch(vertices, stride, indices);
+    stats.acmrAfter = meshACMR(indices.data(), indices.size(), stats.verticesAfter, cacheSize);
+    return stats;
+}
+
+// Grava em 'path' a cena 'in' com a malha otimizada (triângulos; instâncias copiadas como estão)
+inline bool sceneOptimize(const SceneFile &in, const char *path, MeshOptimizeStats &stats)
+{
+    const SceneChunk *vertexChunk = sceneFind(in, SCENE_VERTICES);
+    if (!vertexChunk || in.header->primitive != GL_TRIANGLES) {
+        fprintf(stderr, "cena: só malhas de GL_TRIANGLES são otimizadas\n");
+        return false;
+    }
+    const unsigned char *src = sceneChunkData<unsigned char>(in, *vertexChunk);
+    std::vector<unsigned char> vertices(src, src + vertexChunk->size);
+    std::vector<uint32_t> indices;
+    if (const SceneChunk *indexChunk = sceneFind(in, SCENE_INDICES)) {
+        indices.resize(indexChunk->count);
+        const unsigned char *data = sceneChunkData<unsigned char>(in, *indexChunk);
+        for (uint32_t i = 0; i < indexChunk->count; ++i) {
+            uint32_t index = 0;
+            memcpy(&index, data + size_t(i) * indexChunk->stride, indexChunk->stride); // little-endian
+            if (index >= vertexChunk->count) {
+                fprintf(stderr, "cena: índice %u fora da malha\n", index);
+                return false;
+            }
+            indices[i] = index;
+        }
+    }
+    bool indexed = !indices.empty();
+    stats = meshOptimize(vertices, vertexChunk->stride, indices);
+    if (!indexed && stats.verticesAfter == stats.verticesBefore) {
+        // Nenhum vértice repetido: com índices a cena só cresceria e o ACMR não muda
+        stats.acmrAfter = stats.acmrBefore;
+        std::vector<SceneChunkData> original;
+        for (uint32_t i = 0; i < in.header->chunkCount; ++i)
+            original.push_back({in.chunks[i], sceneChunkData(in, in.chunks[i])});
+        return sceneSave(path, in.header->primitive, in.header->bounds, original);
+    }
+
+    SceneChunk vertexDesc = *vertexChunk;
+    vertexDesc.count = stats.verticesAfter;
+    std::vector<SceneChunkData> chunks = {{vertexDesc, vertices.data()}};
+    std::vector<uint16_t> shortIndices;
+    if (stats.verticesAfter <= 65536) {
+        shortIndices.assign(indices.begin(), indices.end());
+        chunks.push_back({sceneIndexChunk(uint32_t(indices.size()), GL_UNSIGNED_SHORT), shortIndices.data()});
+    } else {
+        chunks.push_back({sceneIndexChunk(uint32_t(indices.size()), GL_UNSIGNED_INT), indices.data()});
+    }
+    if (const SceneChunk *instances = sceneFind(in, SCENE_INSTANCES))
+        chunks.push_back({*instances, sceneChunkData(in, *instances)});
+    return sceneSave(path, GL_TRIANGLES, in.header->bounds, chunks);
+}
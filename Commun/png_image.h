@@ -0,0 +1,93 @@
+#pragma once
+
+// Gravação de PNG RGBA8 sem dependências (sem zlib/libpng): os dados vão em blocos "stored" do
+// deflate, sem compressão. Usado pelo rasterizador em CPU e pela captura de frames.
+// As linhas chegam de baixo para cima (como no glReadPixels) e são gravadas de cima para baixo.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+inline uint32_t pngCrc32(const uint8_t *data, size_t size, uint32_t crc = 0)
+{
+    static uint32_t table[256];
+    static bool ready = false;
+    if (!ready) {
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        ready = true;
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+inline void pngPutBigEndian(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.insert(out.end(), {uint8_t(v >> 24), uint8_t(v >> 16), uint8_t(v >> 8), uint8_t(v)});
+}
+
+inline void pngChunk(FILE *f, const char *type, const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> chunk(type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    std::vector<uint8_t> length, crc;
+    pngPutBigEndian(length, uint32_t(data.size()));
+    pngPutBigEndian(crc, pngCrc32(chunk.data(), chunk.size()));
+    fwrite(length.data(), 1, 4, f);
+    fwrite(chunk.data(), 1, chunk.size(), f);
+    fwrite(crc.data(), 1, 4, f);
+}
+
+// pixels: width * height * 4 bytes, linha 0 embaixo
+inline bool pngWrite(const char *path, const uint8_t *pixels, int width, int height)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "png: não foi possível criar %s\n", path);
+        return false;
+    }
+    const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, 8, f);
+
+    std::vector<uint8_t> header;
+    pngPutBigEndian(header, uint32_t(width));
+    pngPutBigEndian(header, uint32_t(height));
+    header.insert(header.end(), {8, 6, 0, 0, 0}); // 8 bits, RGBA, deflate, filtro 0, sem entrelaçamento
+    pngChunk(f, "IHDR", header);
+
+    // Linhas de cima para baixo, cada uma com o byte de filtro 0
+    std::vector<uint8_t> raw;
+    raw.reserve(size_t(height) * (size_t(width) * 4 + 1));
+    for (int y = height - 1; y >= 0; --y) {
+        raw.push_back(0);
+        const uint8_t *row = pixels + size_t(y) * width * 4;
+        raw.insert(raw.end(), row, row + size_t(width) * 4);
+    }
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    uint32_t s1 = 1, s2 = 0;
+    for (size_t pos = 0;;) {
+        size_t n = std::min<size_t>(65535, raw.size() - pos);
+        bool last = pos + n == raw.size();
+        zlib.insert(zlib.end(), {uint8_t(last), uint8_t(n), uint8_t(n >> 8), uint8_t(~n), uint8_t(~n >> 8)});
+        zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + n);
+        for (size_t i = pos; i < pos + n; ++i) {
+            s1 = (s1 + raw[i]) % 65521;
+            s2 = (s2 + s1) % 65521;
+        }
+        pos += n;
+        if (last)
+            break;
+    }
+    pngPutBigEndian(zlib, (s2 << 16) | s1);
+    pngChunk(f, "IDAT", zlib);
+    pngChunk(f, "IEND", {});
+    fclose(f);
+    return true;
+}
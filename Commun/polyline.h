@@ -0,0 +1,316 @@
+#pragma once
+
+// Polilinhas espessas sem glLineWidth (o core profile e o macOS limitam a largura a 1 pixel).
+// Cada segmento é uma instância expandida no vertex shader, em pixels: o corpo vai até a
+// bissetriz no lado de dentro das curvas e até a perpendicular no lado de fora, onde a junção
+// (em quina, chanfrada ou arredondada) cobre só a cunha entre os dois segmentos. Nada é
+// desenhado duas vezes, então cores translúcidas não escurecem nas junções. A borda recebe
+// anti-aliasing analítico de 1 pixel no fragment shader. Uma polilinha inteira é uma única
+// chamada de desenho. Os pontos são (x, y, z) em NDC, como nos VBOs das atividades; z é ignorado.
+
+#include <vector>
+#include <glad/glad.h>
+#include "shader.h"
+
+enum PolylineJoin
+{
+    POLYLINE_MITER = 0, // chanfrada quando a quina passa de 4 meias larguras
+    POLYLINE_ROUND = 1, // também arredonda as pontas abertas
+    POLYLINE_BEVEL = 2,
+};
+
+constexpr GLsizei POLYLINE_SEGMENT_VERTICES = 15; // faixa: corpo (6), ligação degenerada (2), junção no fim (7)
+
+// Segmento i usa os pontos i..i+3 do VBO: anterior, início, fim e seguinte. Cada instância é uma
+// faixa de triângulos: o corpo (hexágono com A, B e um canto de cada lado em cada ponta), dois
+// vértices repetidos e a junção em B, duas "pipas" com vértice em B que cobrem a cunha externa
+// até a borda de anti-aliasing.
+inline const char *const polylineVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 pPrev;
+layout (location = 1) in vec3 pA;
+layout (location = 2) in vec3 pB;
+layout (location = 3) in vec3 pNext;
+uniform vec2 u_viewport;
+uniform float u_width;                 // pixels
+uniform int u_join;
+out vec2 vLocal;                       // posição em pixels
+out float vAcross;                     // distância com sinal ao eixo do segmento
+flat out vec4 vSegment;                // início e fim em pixels
+flat out vec4 vJoin;                   // normal externa do segmento em B e bissetriz da junção
+flat out int vPart;                    // 0 = corpo, 1 = junção
+
+// Pontos da junção na faixa: 0 = B, 1 = borda do segmento, 2 e 4 = pontas das pipas,
+// 3 = bissetriz, 5 = borda do próximo segmento
+const int JOIN[8] = int[8](1, 1, 2, 0, 3, 0, 4, 5);
+
+vec2 toPixels(vec3 p) { return (p.xy * 0.5 + 0.5) * u_viewport; }
+vec2 leftNormal(vec2 d) { return vec2(-d.y, d.x); }
+vec2 unitOr(vec2 d, vec2 fallback) { return dot(d, d) > 1e-12 ? normalize(d) : fallback; }
+
+// Lado de fora (+1 = esquerda) da curva que vai da direção dIn para dOut
+float outerSide(vec2 dIn, vec2 dOut) { return dIn.x * dOut.y - dIn.y * dOut.x > 0.0 ? -1.0 : 1.0; }
+
+// Canto do corpo no lado 'side' da ponta x, onde a curva vai de dIn para dOut e o vizinho tem
+// comprimento lenN (0 = ponta aberta). Por fora fica na perpendicular (a junção cobre o resto);
+// por dentro, no encontro das bordas dos dois segmentos, a não ser que ele passe da metade do
+// menor deles (curvas muito fechadas), quando volta à perpendicular.
+vec2 bodyCorner(vec2 x, vec2 n, float side, vec2 dIn, vec2 dOut, float len, float lenN, float extent) {
+    vec2 corner = x + n * side * extent;
+    vec2 sum = leftNormal(dIn) + leftNormal(dOut);
+    if (lenN < 1e-6 || side == outerSide(dIn, dOut) || dot(sum, sum) < 1e-8)
+        return corner;
+    vec2 m = normalize(sum) * side;
+    float cosHalf = dot(m, n * side);
+    float shift = extent * sqrt(max(1.0 - cosHalf * cosHalf, 0.0)) / max(cosHalf, 1e-3);
+    return shift > 0.5 * min(len, lenN) ? corner : x + m * extent / cosHalf;
+}
+
+void main() {
+    vec2 prev = toPixels(pPrev), a = toPixels(pA), b = toPixels(pB), next = toPixels(pNext);
+    float len = length(b - a), lenPrev = length(a - prev), lenNext = length(next - b);
+    vec2 dir = unitOr(b - a, vec2(1.0, 0.0));
+    vec2 n = leftNormal(dir);
+    vec2 dNext = unitOr(next - b, dir);
+    float extent = 0.5 * u_width + 1.0;   // 1 pixel extra para o anti-aliasing
+
+    vec2 p;
+    if (gl_VertexID < 7) {
+        // Corpo: cA+, cB+, A, B, cA-, cB- (o 7º repete cB- para ligar com a junção)
+        int corner = min(gl_VertexID, 5);
+        bool atB = (corner & 1) == 1;
+        // Pontas abertas arredondadas: o corpo passa o raio além da ponta
+        vec2 cap = u_join == 1 && (atB ? lenNext : lenPrev) < 1e-6 ? (atB ? dir : -dir) * extent : vec2(0.0);
+        float side = corner < 2 ? 1.0 : -1.0;
+        if (corner == 2 || corner == 3)
+            p = atB ? b : a;
+        else if (atB)
+            p = bodyCorner(b, n, side, dir, dNext, len, lenNext, extent);
+        else
+            p = bodyCorner(a, n, side, unitOr(a - prev, dir), dir, len, lenPrev, extent);
+        p += cap;
+        vPart = 0;
+    } else {
+        float side = outerSide(dir, dNext);
+        vec2 o1 = n * side, o2 = leftNormal(dNext) * side;
+        vec2 m = unitOr(o1 + o2, dir);
+        float cosHalf = dot(m, o1);
+        int point = lenNext < 1e-6 ? 0 : JOIN[gl_VertexID - 7]; // ponta aberta: sem junção
+        if (point == 0) {
+            p = b;
+        } else if (point == 1) {
+            p = b + o1 * extent;
+        } else if (point == 5) {
+            p = b + o2 * extent;
+        } else if (u_join == 0 && cosHalf >= 0.25) {
+            p = b + m * extent / cosHalf; // quina dentro do limite 4: uma pipa só, até a ponta
+        } else if (point == 3) {
+            p = b + m * extent;
+        } else {
+            // Chanfro ou arco: cada pipa cobre metade da cunha (no máximo 90 graus)
+            vec2 edge = point == 2 ? o1 : o2;
+            vec2 h = normalize(edge + m);
+            p = b + h * extent / dot(h, edge);
+        }
+        vJoin = vec4(o1, m);
+        vPart = 1;
+    }
+    vLocal = p;
+    vAcross = dot(p - a, n);
+    vSegment = vec4(a, b);
+    gl_Position = vec4(p / u_viewport * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+inline const char *const polylineFragmentShaderSource = R"(
+#version 400
+in vec2 vLocal;
+in float vAcross;
+flat in vec4 vSegment;
+flat in vec4 vJoin;
+flat in int vPart;
+uniform float u_width;
+uniform int u_join;
+uniform vec4 u_color;
+out vec4 color;
+void main() {
+    float halfWidth = 0.5 * u_width;
+    float d;
+    if (vPart == 1) {
+        // Junção em B: arco, quina (as duas bordas externas) ou quina cortada pelo chanfro
+        vec2 q = vLocal - vSegment.zw;
+        vec2 o1 = vJoin.xy, m = vJoin.zw;
+        float cosHalf = dot(m, o1);
+        vec2 o2 = 2.0 * cosHalf * m - o1;
+        if (u_join == 1) {
+            d = length(q) - halfWidth;
+        } else {
+            d = max(dot(q, o1), dot(q, o2)) - halfWidth;
+            if (u_join == 2 || cosHalf < 0.25)
+                d = max(d, dot(q, m) - halfWidth * cosHalf);
+        }
+    } else if (u_join == 1) {
+        vec2 pa = vLocal - vSegment.xy, ba = vSegment.zw - vSegment.xy;
+        float h = clamp(dot(pa, ba) / max(dot(ba, ba), 1e-6), 0.0, 1.0);
+        d = length(pa - ba * h) - halfWidth;
+    } else {
+        d = abs(vAcross) - halfWidth;
+    }
+    float coverage = clamp(0.5 - d, 0.0, 1.0);
+    if (coverage <= 0.0)
+        discard;
+    color = vec4(u_color.rgb, u_color.a * coverage);
+}
+)";
+
+// Programa compartilhado por todas as polilinhas
+struct PolylineShader
+{
+    GLuint program = 0;
+    GLint viewportLoc = -1, widthLoc = -1, joinLoc = -1, colorLoc = -1;
+};
+
+struct Polyline
+{
+    GLuint VAO = 0, VBO = 0;
+    size_t capacity = 0; // pontos alocados no VBO (com as sentinelas)
+    size_t points = 0;   // pontos da polilinha (sem as sentinelas)
+    GLsizei segments = 0;
+};
+
+// Os 4 atributos leem o mesmo VBO deslocados de um ponto, avançando um ponto por instância
+inline void polylineSetupAttributes(Polyline &line)
+{
+    glBindVertexArray(line.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, line.VBO);
+    for (int i = 0; i < 4; ++i) {
+        glVertexAttribPointer(i, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)(i * 3 * sizeof(float)));
+        glEnableVertexAttribArray(i);
+        glVertexAttribDivisor(i, 1);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+inline PolylineShader createPolylineShader()
+{
+    PolylineShader shader;
+    shader.program = buildShaderProgram(polylineVertexShaderSource, polylineFragmentShaderSource);
+    shader.viewportLoc = glGetUniformLocation(shader.program, "u_viewport");
+    shader.widthLoc = glGetUniformLocation(shader.program, "u_width");
+    shader.joinLoc = glGetUniformLocation(shader.program, "u_join");
+    shader.colorLoc = glGetUniformLocation(shader.program, "u_color");
+    return shader;
+}
+
+inline Polyline createPolyline()
+{
+    Polyline line;
+    glGenVertexArrays(1, &line.VAO);
+    glGenBuffers(1, &line.VBO);
+    polylineSetupAttributes(line);
+    return line;
+}
+
+// Envia 'n' pontos (x, y, z). Fechada equivale a GL_LINE_LOOP, aberta a GL_LINE_STRIP.
+inline void polylineUpload(Polyline &line, const float *points, size_t n, bool closed)
+{
+    line.points = n;
+    line.segments = n < 2 ? 0 : GLsizei(closed ? n : n - 1);
+    if (line.segments == 0)
+        return;
+
+    // Sentinelas: aberta repete as pontas (sem vizinho), fechada dá a volta
+    std::vector<float> padded;
+    padded.reserve((n + 3) * 3);
+    const float *before = closed ? points + (n - 1) * 3 : points;
+    padded.insert(padded.end(), before, before + 3);
+    padded.insert(padded.end(), points, points + n * 3);
+    if (closed)
+        padded.insert(padded.end(), points, points + 6);
+    else
+        padded.insert(padded.end(), points + (n - 1) * 3, points + n * 3);
+
+    glBindBuffer(GL_ARRAY_BUFFER, line.VBO);
+    size_t count = padded.size() / 3;
+    if (count > line.capacity) {
+        line.capacity = count;
+        glBufferData(GL_ARRAY_BUFFER, padded.size() * sizeof(float), padded.data(), GL_DYNAMIC_DRAW);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, padded.size() * sizeof(float), padded.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// Anexa 'n' pontos ao fim de uma polilinha aberta enviando só eles e a sentinela do fim (que
+// passa a ser o último ponto novo). Sem espaço, o VBO dobra e o conteúdo é copiado na própria
+// GPU, como no stream_buffer.h.
+inline void polylineAppend(Polyline &line, const float *points, size_t n)
+{
+    if (n == 0)
+        return;
+    const GLsizeiptr pointBytes = 3 * sizeof(float);
+    size_t kept = line.points == 0 ? 0 : line.points + 1; // sentinela do começo + pontos
+    size_t required = line.points + n + 2;
+    if (required > line.capacity) {
+        size_t newCapacity = line.capacity > 0 ? line.capacity : 64;
+        while (newCapacity < required)
+            newCapacity *= 2;
+        GLuint newVBO;
+        glGenBuffers(1, &newVBO);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, newVBO);
+        glBufferData(GL_COPY_WRITE_BUFFER, newCapacity * pointBytes, nullptr, GL_DYNAMIC_DRAW);
+        if (kept > 0) {
+            glBindBuffer(GL_COPY_READ_BUFFER, line.VBO);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, kept * pointBytes);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        glDeleteBuffers(1, &line.VBO);
+        line.VBO = newVBO;
+        line.capacity = newCapacity;
+        polylineSetupAttributes(line); // o VAO passa a apontar para o novo VBO
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, line.VBO);
+    if (kept == 0) // primeira sentinela: o começo repete o primeiro ponto
+        glBufferSubData(GL_ARRAY_BUFFER, 0, pointBytes, points);
+    size_t first = kept == 0 ? 1 : kept;
+    glBufferSubData(GL_ARRAY_BUFFER, first * pointBytes, n * pointBytes, points);
+    glBufferSubData(GL_ARRAY_BUFFER, (first + n) * pointBytes, pointBytes, points + (n - 1) * 3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    line.points += n;
+    line.segments = line.points < 2 ? 0 : GLsizei(line.points - 1);
+}
+
+// Desenha todos os segmentos em uma única chamada; largura em pixels
+inline void polylineDraw(const PolylineShader &shader, const Polyline &line, float width, PolylineJoin join,
+                         float r, float g, float b, float a, float viewportWidth, float viewportHeight)
+{
+    if (line.segments == 0)
+        return;
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glUseProgram(shader.program);
+    glUniform2f(shader.viewportLoc, viewportWidth, viewportHeight);
+    glUniform1f(shader.widthLoc, width);
+    glUniform1i(shader.joinLoc, int(join));
+    glUniform4f(shader.colorLoc, r, g, b, a);
+    glBindVertexArray(line.VAO);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, POLYLINE_SEGMENT_VERTICES, line.segments);
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+}
+
+inline void deletePolyline(Polyline &line)
+{
+    glDeleteVertexArrays(1, &line.VAO);
+    glDeleteBuffers(1, &line.VBO);
+    line = Polyline();
+}
+
+inline void deletePolylineShader(PolylineShader &shader)
+{
+    glDeleteProgram(shader.program);
+    shader = PolylineShader();
+}
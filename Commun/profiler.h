@@ -0,0 +1,287 @@
+#pragma once
+
+// Perfil de frames exportado no formato do chrome://tracing (e do ui.perfetto.dev): zonas
+// de CPU por escopo em qualquer thread, zonas de GPU medidas com glQueryCounter e alinhadas
+// ao relógio da CPU, e um evento por frame marcando os frames lentos.
+//
+// Uso:
+//   profInit();                        // depois do glad; PROF_TRACE=perfil.json liga o perfil
+//   { PROF_ZONE("desenho"); PROF_GPU_ZONE("desenho"); ... }
+//   profEndFrame();                    // antes de cada glfwSwapBuffers
+//   profShutdown();                    // grava o arquivo (profWriteChromeTrace grava a qualquer momento)
+//
+// Cada thread guarda os últimos PROF_EVENTS_PER_THREAD eventos em um buffer circular, então
+// sessões longas usam memória fixa e o arquivo mostra o fim da sessão.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <glad/glad.h>
+
+constexpr size_t PROF_EVENTS_PER_THREAD = 1 << 18;
+constexpr int PROF_GPU_FRAMES = 4;       // frames em voo antes de ler as queries
+constexpr int PROF_GPU_ZONES = 64;       // zonas de GPU por frame
+constexpr float PROF_HITCH_FACTOR = 4.0f; // frame lento: mais que 4x a média recente
+
+struct ProfEvent
+{
+    const char *name; // literal: não é copiado
+    int64_t startNs;
+    int64_t durationNs;
+};
+
+struct ProfThreadBuffer
+{
+    int tid;
+    std::string name;
+    std::vector<ProfEvent> events;
+    size_t next = 0;
+    bool wrapped = false;
+    std::mutex mutex; // só disputado durante a exportação
+
+    void push(const ProfEvent &e)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (events.size() < PROF_EVENTS_PER_THREAD)
+            events.push_back(e);
+        else
+            events[next] = e, wrapped = true;
+        next = (next + 1) % PROF_EVENTS_PER_THREAD;
+    }
+};
+
+struct ProfGpuFrame
+{
+    GLuint queries[PROF_GPU_ZONES * 2];
+    const char *names[PROF_GPU_ZONES];
+    int count = 0;
+    int open = -1; // zona aberta (as zonas de GPU não se aninham)
+};
+
+struct Profiler
+{
+    bool enabled = false;
+    std::string path;
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ProfThreadBuffer>> threads;
+
+    bool gpu = false;
+    ProfGpuFrame gpuFrames[PROF_GPU_FRAMES];
+    int gpuFrame = 0;
+    int64_t gpuOffsetNs = 0; // tempo da GPU - tempo da CPU
+    ProfThreadBuffer gpuTrack;
+
+    int64_t frameStartNs = 0;
+    double averageFrameNs = 0.0;
+    int frames = 0;
+    int hitches = 0;
+};
+
+inline Profiler profiler;
+inline thread_local ProfThreadBuffer *profThread = nullptr;
+
+inline int64_t profNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profiler.origin)
+        .count();
+}
+
+// Buffer da thread atual, criado no primeiro evento
+inline ProfThreadBuffer &profThreadBuffer()
+{
+    if (!profThread) {
+        std::lock_guard<std::mutex> lock(profiler.mutex);
+        profiler.threads.push_back(std::make_unique<ProfThreadBuffer>());
+        profThread = profiler.threads.back().get();
+        profThread->tid = int(profiler.threads.size());
+        profThread->name = "thread " + std::to_string(profThread->tid);
+    }
+    return *profThread;
+}
+
+inline void profSetThreadName(const char *name) { profThreadBuffer().name = name; }
+
+inline void profRecord(const char *name, int64_t startNs, int64_t endNs)
+{
+    profThreadBuffer().push({name, startNs, endNs - startNs});
+}
+
+// Zona de CPU: mede do construtor ao destrutor
+struct ProfZone
+{
+    const char *name;
+    int64_t startNs;
+    explicit ProfZone(const char *name) : name(name), startNs(profiler.enabled ? profNowNs() : 0) {}
+    ~ProfZone()
+    {
+        if (profiler.enabled)
+            profRecord(name, startNs, profNowNs());
+    }
+};
+
+// Alinha o relógio da GPU ao da CPU (o GL_TIMESTAMP é lido sem esperar a fila)
+inline void profCalibrateGpu()
+{
+    GLint64 gpuNs = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNs);
+    profiler.gpuOffsetNs = gpuNs - profNowNs();
+}
+
+inline void profGpuBegin(const char *name)
+{
+    if (!profiler.gpu)
+        return;
+    ProfGpuFrame &f = profiler.gpuFrames[profiler.gpuFrame];
+    if (f.count == PROF_GPU_ZONES || f.open >= 0)
+        return;
+    f.names[f.count] = name;
+    f.open = f.count;
+    glQueryCounter(f.queries[2 * f.count], GL_TIMESTAMP);
+}
+
+inline void profGpuEnd()
+{
+    if (!profiler.gpu)
+        return;
+    ProfGpuFrame &f = profiler.gpuFrames[profiler.gpuFrame];
+    if (f.open < 0)
+        return;
+    glQueryCounter(f.queries[2 * f.open + 1], GL_TIMESTAMP);
+    f.open = -1;
+    f.count++;
+}
+
+// Zona de GPU: marca o tempo da GPU quando os comandos do escopo começam e terminam
+struct ProfGpuZone
+{
+    explicit ProfGpuZone(const char *name) { profGpuBegin(name); }
+    ~ProfGpuZone() { profGpuEnd(); }
+};
+
+#define PROF_CONCAT_(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_(a, b)
+#define PROF_ZONE(name) ProfZone PROF_CONCAT(profZone, __LINE__)(name)
+#define PROF_GPU_ZONE(name) ProfGpuZone PROF_CONCAT(profGpuZone, __LINE__)(name)
+
+// Lê as queries de um frame antigo (já devem estar prontas, PROF_GPU_FRAMES depois)
+inline void profCollectGpu(ProfGpuFrame &f)
+{
+    for (int i = 0; i < f.count; ++i) {
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(f.queries[2 * i], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(f.queries[2 * i + 1], GL_QUERY_RESULT, &end);
+        profiler.gpuTrack.push({f.names[i], int64_t(begin) - profiler.gpuOffsetNs, int64_t(end - begin)});
+    }
+    f.count = 0;
+}
+
+// PROF_TRACE=arquivo.json liga o perfil; chamar com o contexto GL atual
+inline bool profInit()
+{
+    const char *path = getenv("PROF_TRACE");
+    if (!path || !*path)
+        return false;
+    profiler.enabled = true;
+    profiler.path = path;
+    profSetThreadName("principal");
+    profiler.gpuTrack.tid = 0;
+    profiler.gpuTrack.name = "GPU";
+    profiler.gpu = glQueryCounter != nullptr && glGetInteger64v != nullptr;
+    if (profiler.gpu) {
+        for (ProfGpuFrame &f : profiler.gpuFrames)
+            glGenQueries(PROF_GPU_ZONES * 2, f.queries);
+        profCalibrateGpu();
+    }
+    profiler.frameStartNs = profNowNs();
+    return true;
+}
+
+// Fecha o frame: registra o evento do frame (marcando os lentos) e recolhe a GPU
+inline void profEndFrame()
+{
+    if (!profiler.enabled)
+        return;
+    int64_t now = profNowNs();
+    double duration = double(now - profiler.frameStartNs);
+    bool hitch = profiler.frames > 30 && duration > PROF_HITCH_FACTOR * profiler.averageFrameNs;
+    profRecord(hitch ? "frame lento" : "frame", profiler.frameStartNs, now);
+    profiler.hitches += hitch;
+    // Média móvel exponencial; os frames lentos entram pouco para não mascarar os próximos
+    double weight = profiler.frames == 0 ? 1.0 : hitch ? 0.01 : 0.05;
+    profiler.averageFrameNs += weight * (duration - profiler.averageFrameNs);
+    profiler.frameStartNs = now;
+    profiler.frames++;
+
+    if (profiler.gpu) {
+        profiler.gpuFrame = (profiler.gpuFrame + 1) % PROF_GPU_FRAMES;
+        profCollectGpu(profiler.gpuFrames[profiler.gpuFrame]);
+        // O relógio da GPU pode escorregar em relação ao da CPU em sessões longas
+        if (profiler.frames % 120 == 0)
+            profCalibrateGpu();
+    }
+}
+
+// Escreve os eventos de um buffer em ordem cronológica de chegada
+inline void profWriteEvents(FILE *f, ProfThreadBuffer &t, bool &first)
+{
+    std::lock_guard<std::mutex> lock(t.mutex);
+    fprintf(f, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+            first ? "" : ",", t.tid, t.name.c_str());
+    first = false;
+    size_t count = t.events.size();
+    size_t start = t.wrapped ? t.next : 0;
+    for (size_t i = 0; i < count; ++i) {
+        const ProfEvent &e = t.events[(start + i) % count];
+        fprintf(f, ",\n{\"ph\":\"X\",\"name\":\"%s\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", e.name, t.tid,
+                e.startNs / 1e3, e.durationNs / 1e3);
+    }
+}
+
+// Grava o JSON (Trace Event Format) com todas as threads e a trilha da GPU
+inline bool profWriteChromeTrace(const char *path = nullptr)
+{
+    if (!profiler.enabled)
+        return false;
+    if (!path)
+        path = profiler.path.c_str();
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "profiler: não foi possível criar %s\n", path);
+        return false;
+    }
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    {
+        std::lock_guard<std::mutex> lock(profiler.mutex);
+        for (auto &t : profiler.threads)
+            profWriteEvents(f, *t, first);
+    }
+    if (profiler.gpu)
+        profWriteEvents(f, profiler.gpuTrack, first);
+    fprintf(f, "\n]}\n");
+    fclose(f);
+    fprintf(stderr, "profiler: %d frames (%d lentos) gravados em %s\n", profiler.frames, profiler.hitches, path);
+    return true;
+}
+
+inline void profShutdown()
+{
+    if (!profiler.enabled)
+        return;
+    if (profiler.gpu) {
+        // Recolhe os frames ainda em voo antes de gravar
+        for (int i = 1; i <= PROF_GPU_FRAMES; ++i)
+            profCollectGpu(profiler.gpuFrames[(profiler.gpuFrame + i) % PROF_GPU_FRAMES]);
+    }
+    profWriteChromeTrace();
+    if (profiler.gpu)
+        for (ProfGpuFrame &f : profiler.gpuFrames)
+            glDeleteQueries(PROF_GPU_ZONES * 2, f.queries);
+    profiler.enabled = false;
+}
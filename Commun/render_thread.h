@@ -0,0 +1,145 @@
+#pragma once
+
+// Thread de desenho separada da thread de eventos do GLFW.
+//
+// A thread principal fica com a janela e os eventos (o GLFW exige isso) e a thread de desenho
+// fica com o contexto GL. A comunicação não usa mutex:
+//   SpscQueue<T, N>    fila circular de um produtor e um consumidor para mudanças de estado
+//                      (cada comando é entregue uma vez, na ordem)
+//   SnapshotBuffer<T>  estado pequeno em que só o último valor importa (ex.: estatísticas do
+//                      frame); o escritor e o leitor nunca esperam um pelo outro
+//
+// Uso:
+//   glfwMakeContextCurrent(nullptr);                  // libera o contexto na thread principal
+//   renderThreadStart(render, window, drawLoop);      // drawLoop desenha enquanto
+//                                                     // renderThreadNextFrame(render) for true
+//   while (...) { eventos; renderThreadStep(render); } // passo a passo só no modo sincronizado
+//   renderThreadStop(render);
+//
+// No modo sincronizado (render.lockstep) cada passo de eventos espera um frame completo, para
+// que a reprodução de entrada e a captura de imagem deem sempre o mesmo resultado.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <GLFW/glfw3.h>
+
+constexpr size_t RENDER_CACHE_LINE = 64;
+
+// Fila circular sem trava: só uma thread chama push e só uma chama pop. N é potência de 2.
+template <typename T, size_t N>
+struct SpscQueue
+{
+    static_assert((N & (N - 1)) == 0, "N deve ser potência de 2");
+    static constexpr size_t capacity = N;
+
+    T items[N];
+    alignas(RENDER_CACHE_LINE) std::atomic<size_t> head{0}; // próxima posição lida (consumidor)
+    alignas(RENDER_CACHE_LINE) std::atomic<size_t> tail{0}; // próxima posição escrita (produtor)
+
+    // Falha (devolve false) com a fila cheia; o produtor decide se descarta ou tenta de novo
+    bool push(const T &item)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == N)
+            return false;
+        items[t & (N - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &item)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return false;
+        item = items[h & (N - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+// Três cópias: uma sendo escrita, uma sendo lida e a última publicada. O escritor troca a sua
+// pela publicada; o leitor troca a sua pela publicada se houver uma nova.
+template <typename T>
+struct SnapshotBuffer
+{
+    static constexpr uint32_t FRESH = 4; // bit marcando que a publicada ainda não foi lida
+
+    T slots[3];
+    std::atomic<uint32_t> published{1};
+    uint32_t writing = 0, reading = 2;
+
+    T &writeSlot() { return slots[writing]; }
+
+    void publish()
+    {
+        writing = published.exchange(writing | FRESH, std::memory_order_acq_rel) & ~FRESH;
+    }
+
+    // Devolve a cópia mais nova já publicada (a mesma de antes se não houve publicação)
+    const T &read()
+    {
+        if (published.load(std::memory_order_relaxed) & FRESH)
+            reading = published.exchange(reading, std::memory_order_acq_rel) & ~FRESH;
+        return slots[reading];
+    }
+};
+
+struct RenderThread
+{
+    std::thread thread;
+    std::atomic<bool> running{false};
+    bool lockstep = false;
+    std::atomic<uint64_t> requested{0}; // passos pedidos pela thread de eventos (sincronizado)
+    std::atomic<uint64_t> completed{0}; // frames terminados pela thread de desenho
+};
+
+// Na thread de desenho: true enquanto deve desenhar mais um frame. No modo sincronizado espera
+// o próximo passo da thread de eventos.
+inline bool renderThreadNextFrame(RenderThread &render)
+{
+    if (render.lockstep)
+        while (render.running.load(std::memory_order_acquire) &&
+               render.completed.load(std::memory_order_relaxed) == render.requested.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    return render.running.load(std::memory_order_acquire);
+}
+
+// Na thread de desenho, depois do glfwSwapBuffers
+inline void renderThreadFrameDone(RenderThread &render)
+{
+    render.completed.fetch_add(1, std::memory_order_release);
+}
+
+// Na thread principal: drawLoop(window) roda na thread nova com o contexto da janela atual e
+// desenha enquanto renderThreadNextFrame devolver true. O contexto não pode estar atual na
+// thread principal.
+inline void renderThreadStart(RenderThread &render, GLFWwindow *window, std::function<void(GLFWwindow *)> drawLoop)
+{
+    render.running = true;
+    render.thread = std::thread([window, drawLoop] {
+        glfwMakeContextCurrent(window);
+        drawLoop(window);
+        glfwMakeContextCurrent(nullptr);
+    });
+}
+
+// Na thread principal, no modo sincronizado: libera um frame e espera ele terminar
+inline void renderThreadStep(RenderThread &render)
+{
+    if (!render.lockstep)
+        return;
+    uint64_t target = render.requested.fetch_add(1, std::memory_order_release) + 1;
+    while (render.running.load(std::memory_order_acquire) && render.completed.load(std::memory_order_acquire) < target)
+        std::this_thread::yield();
+}
+
+inline void renderThreadStop(RenderThread &render)
+{
+    render.running.store(false, std::memory_order_release);
+    if (render.thread.joinable())
+        render.thread.join();
+}
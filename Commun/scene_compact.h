@@ -0,0 +1,226 @@
+#pragma once
+
+// Layout compacto de vértices para cenas 2D grandes: posição em int16 normalizado em relação aos
+// limites da cena e cor em RGBA8 normalizado, 8 bytes por vértice em vez de 20 a 28 (float x, y,
+// z sempre 0 e cor em float). Quem desenha não muda: o tipo de cada atributo está no descritor
+// do pedaço e o sceneSetupAttributes já escolhe o glVertexAttribPointer certo.
+//
+//   SceneFile in;
+//   sceneOpen("casa.cena", in);
+//   sceneCompact(in, "casa-compacta.cena");     // grava a versão compacta
+//
+// As posições são levadas para [-1, 1] dentro da caixa dos vértices (erro de até 1/65534 da
+// meia largura da cena, menos de 0,01 px numa janela de 800 px) e os limites gravados no
+// cabeçalho passam pela mesma conta, então a imagem na tela é a mesma. Deslocamentos de
+// instância continuam em float (só escalados), porque podem sair da caixa dos vértices. Índices
+// de 32 bits viram 16 bits quando há até 65536 vértices. Meia precisão (half float) não foi
+// usada para a posição: longe da origem ela perde precisão (0,5 px em x = 600, por exemplo).
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "scene_file.h"
+
+// Vértice compacto
+struct ScenePackedVertex
+{
+    int16_t x, y;
+    uint8_t r, g, b, a;
+};
+static_assert(sizeof(ScenePackedVertex) == 8, "ScenePackedVertex deve ter 8 bytes");
+
+// Instância compacta: deslocamento em float, cor em RGBA8
+struct ScenePackedInstance
+{
+    float dx, dy;
+    uint8_t r, g, b, a;
+};
+static_assert(sizeof(ScenePackedInstance) == 12, "ScenePackedInstance deve ter 12 bytes");
+
+inline int16_t sceneQuantizeSnorm16(float v)
+{
+    return int16_t(lrintf(std::min(1.0f, std::max(-1.0f, v)) * 32767.0f));
+}
+
+inline uint8_t sceneQuantizeUnorm8(float v)
+{
+    return uint8_t(lrintf(std::min(1.0f, std::max(0.0f, v)) * 255.0f));
+}
+
+inline float sceneHalfToFloat(uint16_t h)
+{
+    int exponent = (h >> 10) & 0x1F, mantissa = h & 0x3FF;
+    float v = exponent == 0    ? ldexpf(float(mantissa), -24)
+              : exponent == 31 ? (mantissa ? NAN : INFINITY)
+                               : ldexpf(float(mantissa | 0x400), exponent - 25);
+    return h & 0x8000 ? -v : v;
+}
+
+// Lê um atributo de um elemento como float, com a mesma conversão que o OpenGL faria; componentes
+// ausentes ficam como no shader (0, 0, 0, 1)
+inline void sceneReadAttribute(const unsigned char *element, const SceneAttribute &a, float out[4])
+{
+    out[0] = out[1] = out[2] = 0.0f;
+    out[3] = 1.0f;
+    const unsigned char *p = element + a.offset;
+    for (int i = 0; i < a.components; ++i) {
+        float v = 0.0f;
+        switch (a.type) {
+        case GL_FLOAT: {
+            memcpy(&v, p + 4 * i, 4);
+            break;
+        }
+        case GL_HALF_FLOAT: {
+            uint16_t h;
+            memcpy(&h, p + 2 * i, 2);
+            v = sceneHalfToFloat(h);
+            break;
+        }
+        case GL_BYTE:
+            v = a.normalized ? std::max(-1.0f, int8_t(p[i]) / 127.0f) : float(int8_t(p[i]));
+            break;
+        case GL_UNSIGNED_BYTE:
+            v = a.normalized ? p[i] / 255.0f : float(p[i]);
+            break;
+        case GL_SHORT: {
+            int16_t s;
+            memcpy(&s, p + 2 * i, 2);
+            v = a.normalized ? std::max(-1.0f, s / 32767.0f) : float(s);
+            break;
+        }
+        case GL_UNSIGNED_SHORT: {
+            uint16_t s;
+            memcpy(&s, p + 2 * i, 2);
+            v = a.normalized ? s / 65535.0f : float(s);
+            break;
+        }
+        case GL_INT: {
+            int32_t s;
+            memcpy(&s, p + 4 * i, 4);
+            v = a.normalized ? std::max(-1.0f, float(s / 2147483647.0)) : float(s);
+            break;
+        }
+        case GL_UNSIGNED_INT: {
+            uint32_t s;
+            memcpy(&s, p + 4 * i, 4);
+            v = a.normalized ? float(s / 4294967295.0) : float(s);
+            break;
+        }
+        }
+        out[i] = v;
+    }
+}
+
+inline const SceneAttribute *sceneFindAttribute(const SceneChunk &chunk, uint8_t location)
+{
+    for (uint32_t k = 0; k < chunk.attributeCount; ++k)
+        if (chunk.attributes[k].location == location)
+            return &chunk.attributes[k];
+    return nullptr;
+}
+
+// Grava em 'path' a cena 'in' com o layout compacto
+inline bool sceneCompact(const SceneFile &in, const char *path)
+{
+    const SceneChunk *vertices = sceneFind(in, SCENE_VERTICES);
+    const SceneAttribute *position = vertices ? sceneFindAttribute(*vertices, SCENE_POSITION) : nullptr;
+    if (!position) {
+        fprintf(stderr, "cena: sem posições para compactar\n");
+        return false;
+    }
+    const SceneAttribute *color = sceneFindAttribute(*vertices, SCENE_COLOR);
+    const unsigned char *src = sceneChunkData<unsigned char>(in, *vertices);
+
+    // Caixa dos vértices: centro e meia largura de cada eixo
+    float lo[2] = {INFINITY, INFINITY}, hi[2] = {-INFINITY, -INFINITY}, v[4];
+    for (uint32_t i = 0; i < vertices->count; ++i) {
+        sceneReadAttribute(src + size_t(i) * vertices->stride, *position, v);
+        for (int k = 0; k < 2; ++k) {
+            lo[k] = std::min(lo[k], v[k]);
+            hi[k] = std::max(hi[k], v[k]);
+        }
+    }
+    float center[2], halfSize[2];
+    for (int k = 0; k < 2; ++k) {
+        center[k] = vertices->count ? 0.5f * (lo[k] + hi[k]) : 0.0f;
+        halfSize[k] = vertices->count && hi[k] > lo[k] ? 0.5f * (hi[k] - lo[k]) : 1.0f;
+    }
+
+    // Sem cor na cena original, só a posição: 4 bytes por vértice
+    uint32_t stride = color ? sizeof(ScenePackedVertex) : offsetof(ScenePackedVertex, r);
+    std::vector<unsigned char> packed(size_t(vertices->count) * stride);
+    for (uint32_t i = 0; i < vertices->count; ++i) {
+        const unsigned char *element = src + size_t(i) * vertices->stride;
+        ScenePackedVertex out = {};
+        sceneReadAttribute(element, *position, v);
+        out.x = sceneQuantizeSnorm16((v[0] - center[0]) / halfSize[0]);
+        out.y = sceneQuantizeSnorm16((v[1] - center[1]) / halfSize[1]);
+        if (color) {
+            sceneReadAttribute(element, *color, v);
+            out.r = sceneQuantizeUnorm8(v[0]);
+            out.g = sceneQuantizeUnorm8(v[1]);
+            out.b = sceneQuantizeUnorm8(v[2]);
+            out.a = sceneQuantizeUnorm8(v[3]);
+        }
+        memcpy(&packed[size_t(i) * stride], &out, stride);
+    }
+    SceneChunk packedDesc = sceneChunk(SCENE_VERTICES, vertices->count, stride,
+                                       {sceneAttribute(SCENE_POSITION, 2, GL_SHORT, offsetof(ScenePackedVertex, x), true)});
+    if (color)
+        packedDesc.attributes[packedDesc.attributeCount++] =
+            sceneAttribute(SCENE_COLOR, 4, GL_UNSIGNED_BYTE, offsetof(ScenePackedVertex, r), true);
+    std::vector<SceneChunkData> chunks = {{packedDesc, packed.data()}};
+
+    // Índices: 16 bits quando todos os vértices cabem
+    std::vector<uint16_t> shortIndices;
+    if (const SceneChunk *indices = sceneFind(in, SCENE_INDICES)) {
+        if (indices->indexType == GL_UNSIGNED_INT && vertices->count <= 65536) {
+            const uint32_t *idx = sceneChunkData<uint32_t>(in, *indices);
+            shortIndices.assign(idx, idx + indices->count);
+            chunks.push_back({sceneIndexChunk(indices->count, GL_UNSIGNED_SHORT), shortIndices.data()});
+        } else {
+            chunks.push_back({*indices, sceneChunkData(in, *indices)});
+        }
+    }
+
+    // Instâncias: deslocamento escalado para o mesmo espaço das posições (sem o centro, que já
+    // foi tirado dos vértices), cor em RGBA8
+    std::vector<ScenePackedInstance> packedInstances;
+    if (const SceneChunk *instances = sceneFind(in, SCENE_INSTANCES)) {
+        const SceneAttribute *offset = sceneFindAttribute(*instances, SCENE_OFFSET);
+        const SceneAttribute *instanceColor = sceneFindAttribute(*instances, SCENE_COLOR);
+        const unsigned char *isrc = sceneChunkData<unsigned char>(in, *instances);
+        packedInstances.resize(instances->count);
+        for (uint32_t i = 0; i < instances->count; ++i) {
+            const unsigned char *element = isrc + size_t(i) * instances->stride;
+            ScenePackedInstance &out = packedInstances[i];
+            v[0] = v[1] = 0.0f;
+            if (offset)
+                sceneReadAttribute(element, *offset, v);
+            out.dx = v[0] / halfSize[0];
+            out.dy = v[1] / halfSize[1];
+            v[0] = v[1] = v[2] = v[3] = 1.0f;
+            if (instanceColor)
+                sceneReadAttribute(element, *instanceColor, v);
+            out.r = sceneQuantizeUnorm8(v[0]);
+            out.g = sceneQuantizeUnorm8(v[1]);
+            out.b = sceneQuantizeUnorm8(v[2]);
+            out.a = sceneQuantizeUnorm8(v[3]);
+        }
+        SceneChunk desc = sceneChunk(SCENE_INSTANCES, instances->count, sizeof(ScenePackedInstance),
+                                     {sceneAttribute(SCENE_OFFSET, 2, GL_FLOAT, offsetof(ScenePackedInstance, dx))});
+        if (instanceColor) // sem cor na instância, a cor dos vértices continua valendo
+            desc.attributes[desc.attributeCount++] =
+                sceneAttribute(SCENE_COLOR, 4, GL_UNSIGNED_BYTE, offsetof(ScenePackedInstance, r), true);
+        chunks.push_back({desc, packedInstances.data()});
+    }
+
+    // A janela do mundo passa pela mesma conta das posições
+    const float *b = in.header->bounds;
+    float bounds[4] = {(b[0] - center[0]) / halfSize[0], (b[1] - center[1]) / halfSize[1],
+                       (b[2] - center[0]) / halfSize[0], (b[3] - center[1]) / halfSize[1]};
+    return sceneSave(path, in.header->primitive, bounds, chunks);
+}
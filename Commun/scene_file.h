@@ -0,0 +1,401 @@
+#pragma once
+
+// Formato binário de cena (.cena): cabeçalho, tabela de pedaços com o layout dos vértices e os
+// dados de vértices/índices/instâncias alinhados a 4 KB. Na leitura o arquivo é mapeado na
+// memória (mmap) e cada pedaço vai direto para o glBufferData, sem interpretar nem copiar.
+//
+//   // gravar (ex.: ao sair de um editor)
+//   SceneChunkData vertices{sceneChunk(SCENE_VERTICES, n, sizeof(Vertex),
+//                                      {sceneAttribute(SCENE_POSITION, 2, GL_FLOAT, 0)}), data};
+//   sceneSave("casa.cena", GL_TRIANGLES, bounds, {vertices});
+//   // ler e enviar à GPU
+//   SceneFile file;  SceneMesh mesh;
+//   if (sceneOpen("casa.cena", file) && sceneUpload(file, mesh)) ...
+//   sceneDraw(mesh);
+//   sceneClose(file);           // pode fechar logo depois do envio
+//
+// Layout do arquivo (little-endian, como x86 e ARM):
+//   SceneHeader | SceneChunk[chunkCount] | dados do 1º pedaço (alinhado) | dados do 2º ...
+// Uma cena é uma malha: um pedaço de vértices, um de índices (opcional) e um de instâncias
+// (opcional, com divisor 1). Os atributos usam os locais fixos SCENE_POSITION/COLOR/OFFSET, então
+// qualquer programa desenha qualquer cena com o mesmo shader; 'bounds' é a janela do mundo.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <glad/glad.h>
+
+constexpr char SCENE_MAGIC[8] = {'P', 'G', 'C', 'E', 'N', 'A', '\r', '\n'};
+constexpr uint32_t SCENE_VERSION = 1;
+constexpr uint64_t SCENE_CHUNK_ALIGN = 4096; // página: o driver lê os pedaços direto do mapeamento
+constexpr int SCENE_MAX_ATTRIBUTES = 6;
+constexpr uint32_t SCENE_MAX_CHUNKS = 64;
+
+enum SceneChunkKind : uint32_t
+{
+    SCENE_VERTICES = 1,
+    SCENE_INDICES,
+    SCENE_INSTANCES
+};
+
+// Locais dos atributos no shader (layout (location = N))
+enum SceneAttributeLocation : uint8_t
+{
+    SCENE_POSITION = 0, // x, y (z opcional)
+    SCENE_COLOR = 1,    // r, g, b (a opcional)
+    SCENE_OFFSET = 2    // deslocamento x, y somado à posição (instâncias)
+};
+
+struct SceneAttribute
+{
+    uint8_t location;
+    uint8_t components;
+    uint8_t normalized; // inteiros convertidos para [0, 1] ou [-1, 1]
+    uint8_t reserved;
+    uint32_t type;      // GL_FLOAT, GL_SHORT, GL_UNSIGNED_BYTE...
+    uint32_t offset;    // dentro do elemento
+};
+static_assert(sizeof(SceneAttribute) == 12, "SceneAttribute deve ter 12 bytes");
+
+struct SceneChunk
+{
+    uint32_t kind;
+    uint32_t count;          // vértices, índices ou instâncias
+    uint32_t stride;         // bytes por elemento
+    uint32_t indexType;      // índices: GL_UNSIGNED_INT, GL_UNSIGNED_SHORT ou GL_UNSIGNED_BYTE
+    uint32_t attributeCount;
+    uint32_t reserved;
+    uint64_t offset, size;   // posição no arquivo (alinhada) e tamanho dos dados
+    SceneAttribute attributes[SCENE_MAX_ATTRIBUTES];
+};
+static_assert(sizeof(SceneChunk) == 112, "SceneChunk deve ter 112 bytes");
+
+struct SceneHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t chunkCount;
+    uint32_t primitive; // GL_TRIANGLES, GL_LINE_STRIP...
+    uint32_t reserved;
+    float bounds[4];    // x mínimo, y mínimo, x máximo, y máximo
+    uint64_t fileSize;
+};
+static_assert(sizeof(SceneHeader) == 48, "SceneHeader deve ter 48 bytes");
+
+inline uint32_t sceneTypeSize(uint32_t type)
+{
+    switch (type) {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+    case GL_HALF_FLOAT:
+        return 2;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_FLOAT:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+inline SceneAttribute sceneAttribute(uint8_t location, uint8_t components, uint32_t type, uint32_t offset,
+                                     bool normalized = false)
+{
+    return {location, components, uint8_t(normalized), 0, type, offset};
+}
+
+inline SceneChunk sceneChunk(uint32_t kind, uint32_t count, uint32_t stride,
+                             std::initializer_list<SceneAttribute> attributes = {})
+{
+    SceneChunk chunk = {};
+    chunk.kind = kind;
+    chunk.count = count;
+    chunk.stride = stride;
+    for (const SceneAttribute &a : attributes)
+        if (chunk.attributeCount < SCENE_MAX_ATTRIBUTES)
+            chunk.attributes[chunk.attributeCount++] = a;
+    return chunk;
+}
+
+inline SceneChunk sceneIndexChunk(uint32_t count, uint32_t indexType)
+{
+    SceneChunk chunk = sceneChunk(SCENE_INDICES, count, sceneTypeSize(indexType));
+    chunk.indexType = indexType;
+    return chunk;
+}
+
+// Confere se o pedaço tem exatamente o layout esperado (para programas que leem os elementos
+// na CPU em vez de só enviá-los à GPU)
+inline bool sceneHasLayout(const SceneChunk &chunk, uint32_t stride, std::initializer_list<SceneAttribute> attributes)
+{
+    if (chunk.stride != stride || chunk.attributeCount != attributes.size())
+        return false;
+    const SceneAttribute *a = chunk.attributes;
+    for (const SceneAttribute &expected : attributes) {
+        if (a->location != expected.location || a->components != expected.components ||
+            a->normalized != expected.normalized || a->type != expected.type || a->offset != expected.offset)
+            return false;
+        ++a;
+    }
+    return true;
+}
+
+// --- Gravação ---
+
+// Um pedaço a gravar: o descritor (offset e size são preenchidos por sceneSave) e os dados
+struct SceneChunkData
+{
+    SceneChunk desc;
+    const void *data;
+};
+
+// Grava em 'path.tmp' e renomeia no fim: um editor que cai no meio não estraga a cena anterior
+inline bool sceneSave(const char *path, GLenum primitive, const float bounds[4], std::vector<SceneChunkData> chunks)
+{
+    SceneHeader header = {};
+    memcpy(header.magic, SCENE_MAGIC, sizeof(SCENE_MAGIC));
+    header.version = SCENE_VERSION;
+    header.chunkCount = uint32_t(chunks.size());
+    header.primitive = primitive;
+    memcpy(header.bounds, bounds, sizeof(header.bounds));
+    uint64_t offset = sizeof(SceneHeader) + chunks.size() * sizeof(SceneChunk);
+    for (SceneChunkData &c : chunks) {
+        offset = (offset + SCENE_CHUNK_ALIGN - 1) & ~(SCENE_CHUNK_ALIGN - 1);
+        c.desc.offset = offset;
+        c.desc.size = uint64_t(c.desc.count) * c.desc.stride;
+        offset += c.desc.size;
+    }
+    header.fileSize = offset;
+
+    std::vector<char> tmpPath(strlen(path) + 5);
+    snprintf(tmpPath.data(), tmpPath.size(), "%s.tmp", path);
+    FILE *f = fopen(tmpPath.data(), "wb");
+    if (!f) {
+        fprintf(stderr, "cena: não foi possível criar %s\n", tmpPath.data());
+        return false;
+    }
+    static const char zeros[SCENE_CHUNK_ALIGN] = {};
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (const SceneChunkData &c : chunks)
+        ok = ok && fwrite(&c.desc, sizeof(SceneChunk), 1, f) == 1;
+    uint64_t written = sizeof(SceneHeader) + chunks.size() * sizeof(SceneChunk);
+    for (const SceneChunkData &c : chunks) {
+        ok = ok && fwrite(zeros, 1, c.desc.offset - written, f) == c.desc.offset - written;
+        ok = ok && fwrite(c.data, 1, c.desc.size, f) == c.desc.size;
+        written = c.desc.offset + c.desc.size;
+    }
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmpPath.data(), path) != 0) {
+        fprintf(stderr, "cena: falha ao gravar %s\n", path);
+        remove(tmpPath.data());
+        return false;
+    }
+    return true;
+}
+
+// --- Leitura ---
+
+struct SceneFile
+{
+    const unsigned char *data = nullptr; // arquivo inteiro, mapeado só para leitura
+    size_t size = 0;
+    const SceneHeader *header = nullptr;
+    const SceneChunk *chunks = nullptr;
+};
+
+inline void sceneClose(SceneFile &file)
+{
+    if (file.data)
+        munmap((void *)file.data, file.size);
+    file = SceneFile();
+}
+
+// Confere o cabeçalho e cada descritor contra o tamanho do arquivo; nenhum dado é lido aqui
+inline bool sceneValidate(const SceneFile &file, const char *path)
+{
+    const SceneHeader &h = *file.header;
+    if (memcmp(h.magic, SCENE_MAGIC, sizeof(SCENE_MAGIC)) != 0) {
+        fprintf(stderr, "cena: %s não é um arquivo de cena\n", path);
+        return false;
+    }
+    if (h.version != SCENE_VERSION) {
+        fprintf(stderr, "cena: %s tem a versão %u (esperada %u)\n", path, h.version, SCENE_VERSION);
+        return false;
+    }
+    if (h.chunkCount > SCENE_MAX_CHUNKS || h.fileSize != file.size ||
+        sizeof(SceneHeader) + uint64_t(h.chunkCount) * sizeof(SceneChunk) > file.size) {
+        fprintf(stderr, "cena: %s está truncado ou corrompido\n", path);
+        return false;
+    }
+    for (uint32_t i = 0; i < h.chunkCount; ++i) {
+        const SceneChunk &c = file.chunks[i];
+        bool ok = c.kind >= SCENE_VERTICES && c.kind <= SCENE_INSTANCES && c.stride > 0 &&
+                  c.offset % SCENE_CHUNK_ALIGN == 0 && c.offset <= file.size && c.size <= file.size - c.offset &&
+                  c.size == uint64_t(c.count) * c.stride && c.attributeCount <= SCENE_MAX_ATTRIBUTES;
+        if (ok && c.kind == SCENE_INDICES)
+            ok = sceneTypeSize(c.indexType) == c.stride && c.indexType != GL_FLOAT && c.indexType != GL_HALF_FLOAT;
+        for (uint32_t k = 0; ok && k < c.attributeCount; ++k) {
+            const SceneAttribute &a = c.attributes[k];
+            ok = a.components >= 1 && a.components <= 4 && sceneTypeSize(a.type) > 0 &&
+                 uint64_t(a.offset) + a.components * sceneTypeSize(a.type) <= c.stride;
+        }
+        if (!ok) {
+            fprintf(stderr, "cena: %s tem o pedaço %u inválido\n", path, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool sceneOpen(const char *path, SceneFile &file)
+{
+    sceneClose(file);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "cena: não foi possível abrir %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || size_t(info.st_size) < sizeof(SceneHeader)) {
+        fprintf(stderr, "cena: %s está truncado ou corrompido\n", path);
+        close(fd);
+        return false;
+    }
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    // Linux: o arquivo é lido já no mmap, em sequência, em vez de uma falta de página por vez
+    // durante a cópia do driver
+    flags |= MAP_POPULATE;
+#endif
+    void *data = mmap(nullptr, size_t(info.st_size), PROT_READ, flags, fd, 0);
+    close(fd); // o mapeamento continua válido
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "cena: não foi possível mapear %s\n", path);
+        return false;
+    }
+    // Leitura de ponta a ponta: o kernel lê adiante enquanto o driver copia
+    madvise(data, size_t(info.st_size), MADV_SEQUENTIAL);
+    madvise(data, size_t(info.st_size), MADV_WILLNEED);
+    file.data = (const unsigned char *)data;
+    file.size = size_t(info.st_size);
+    file.header = (const SceneHeader *)file.data;
+    file.chunks = (const SceneChunk *)(file.data + sizeof(SceneHeader));
+    if (!sceneValidate(file, path)) {
+        sceneClose(file);
+        return false;
+    }
+    return true;
+}
+
+// Primeiro pedaço do tipo pedido (nullptr se não houver)
+inline const SceneChunk *sceneFind(const SceneFile &file, uint32_t kind)
+{
+    for (uint32_t i = 0; i < file.header->chunkCount; ++i)
+        if (file.chunks[i].kind == kind)
+            return &file.chunks[i];
+    return nullptr;
+}
+
+template <typename T = void> const T *sceneChunkData(const SceneFile &file, const SceneChunk &chunk)
+{
+    return (const T *)(file.data + chunk.offset);
+}
+
+// --- Envio à GPU ---
+
+struct SceneMesh
+{
+    GLuint VAO = 0;
+    GLuint vertexBuffer = 0, indexBuffer = 0, instanceBuffer = 0;
+    GLenum primitive = GL_TRIANGLES;
+    GLsizei count = 0;     // vértices ou índices desenhados
+    GLenum indexType = 0;  // 0: sem índices
+    GLsizei instances = 0; // 0: sem instâncias
+    float bounds[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+};
+
+// Liga os atributos do pedaço ao buffer em GL_ARRAY_BUFFER (o VAO precisa estar ligado)
+inline void sceneSetupAttributes(const SceneChunk &chunk, GLuint divisor)
+{
+    for (uint32_t k = 0; k < chunk.attributeCount; ++k) {
+        const SceneAttribute &a = chunk.attributes[k];
+        glVertexAttribPointer(a.location, a.components, a.type, a.normalized ? GL_TRUE : GL_FALSE, GLsizei(chunk.stride),
+                              (const GLvoid *)uintptr_t(a.offset));
+        glEnableVertexAttribArray(a.location);
+        glVertexAttribDivisor(a.location, divisor);
+    }
+}
+
+inline GLuint sceneUploadChunk(const SceneFile &file, const SceneChunk &chunk, GLenum target)
+{
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(target, buffer);
+    // Os bytes saem do mapeamento direto para o driver: sem cópia intermediária no programa
+    glBufferData(target, GLsizeiptr(chunk.size), sceneChunkData(file, chunk), GL_STATIC_DRAW);
+    return buffer;
+}
+
+// Cria os buffers e o VAO da cena (no contexto atual); depois disso o arquivo pode ser fechado
+inline bool sceneUpload(const SceneFile &file, SceneMesh &mesh)
+{
+    const SceneChunk *vertices = sceneFind(file, SCENE_VERTICES);
+    const SceneChunk *indices = sceneFind(file, SCENE_INDICES);
+    const SceneChunk *instances = sceneFind(file, SCENE_INSTANCES);
+    if (!vertices) {
+        fprintf(stderr, "cena: sem pedaço de vértices\n");
+        return false;
+    }
+    mesh.primitive = file.header->primitive;
+    memcpy(mesh.bounds, file.header->bounds, sizeof(mesh.bounds));
+    glGenVertexArrays(1, &mesh.VAO);
+    glBindVertexArray(mesh.VAO);
+    mesh.vertexBuffer = sceneUploadChunk(file, *vertices, GL_ARRAY_BUFFER);
+    sceneSetupAttributes(*vertices, 0);
+    mesh.count = GLsizei(vertices->count);
+    if (instances) {
+        mesh.instanceBuffer = sceneUploadChunk(file, *instances, GL_ARRAY_BUFFER);
+        sceneSetupAttributes(*instances, 1);
+        mesh.instances = GLsizei(instances->count);
+    }
+    if (indices) {
+        mesh.indexBuffer = sceneUploadChunk(file, *indices, GL_ELEMENT_ARRAY_BUFFER); // fica no VAO
+        mesh.indexType = indices->indexType;
+        mesh.count = GLsizei(indices->count);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+inline void sceneDraw(const SceneMesh &mesh)
+{
+    glBindVertexArray(mesh.VAO);
+    if (mesh.indexType && mesh.instanceBuffer)
+        glDrawElementsInstanced(mesh.primitive, mesh.count, mesh.indexType, nullptr, mesh.instances);
+    else if (mesh.indexType)
+        glDrawElements(mesh.primitive, mesh.count, mesh.indexType, nullptr);
+    else if (mesh.instanceBuffer)
+        glDrawArraysInstanced(mesh.primitive, 0, mesh.count, mesh.instances);
+    else
+        glDrawArrays(mesh.primitive, 0, mesh.count);
+    glBindVertexArray(0);
+}
+
+inline void deleteSceneMesh(SceneMesh &mesh)
+{
+    glDeleteBuffers(1, &mesh.vertexBuffer);
+    glDeleteBuffers(1, &mesh.indexBuffer);
+    glDeleteBuffers(1, &mesh.instanceBuffer);
+    glDeleteVertexArrays(1, &mesh.VAO);
+    mesh = SceneMesh();
+}
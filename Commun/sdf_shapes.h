@@ -0,0 +1,191 @@
+#pragma once
+
+// Formas desenhadas como um único quad instanciado, avaliando a função de distância
+// com sinal (SDF) no fragment shader: círculo, setor (fatia de pizza / Pac-Man) e
+// estrela de n pontas. A borda recebe anti-aliasing analítico de 1 pixel.
+// Coordenadas em pixels, com origem no canto inferior esquerdo da viewport.
+
+#include <vector>
+#include <glad/glad.h>
+#include "shader.h"
+
+enum SdfKind
+{
+    SDF_CIRCLE = 0,
+    SDF_SECTOR = 1, // p0 = meia abertura (rad), rotation = direção do centro do setor
+    SDF_STAR = 2,   // p0 = número de pontas, p1 = raio interno / raio externo, rotation = direção da 1ª ponta
+};
+
+// Uma instância = 3 atributos vec4
+struct SdfShape
+{
+    float x, y, radius, rotation;
+    float kind, p0, p1, pad;
+    float r, g, b, a;
+};
+
+inline SdfShape sdfCircle(float x, float y, float radius, float r, float g, float b)
+{
+    return {x, y, radius, 0.0f, float(SDF_CIRCLE), 0.0f, 0.0f, 0.0f, r, g, b, 1.0f};
+}
+
+// Setor entre os ângulos 'start' e 'end' (rad, anti-horário)
+inline SdfShape sdfSector(float x, float y, float radius, float start, float end, float r, float g, float b)
+{
+    return {x, y, radius, 0.5f * (start + end), float(SDF_SECTOR), 0.5f * (end - start), 0.0f, 0.0f, r, g, b, 1.0f};
+}
+
+inline SdfShape sdfStar(float x, float y, float radius, int points, float innerRadius, float rotation,
+                        float r, float g, float b)
+{
+    return {x, y, radius, rotation, float(SDF_STAR), float(points), innerRadius / radius, 0.0f, r, g, b, 1.0f};
+}
+
+inline const char *const sdfVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec2 corner;      // canto do quad em [-1, 1]
+layout (location = 1) in vec4 shape;       // centro (px), raio (px), rotação
+layout (location = 2) in vec4 params;      // tipo, p0, p1
+layout (location = 3) in vec4 instColor;
+uniform vec2 u_viewport;
+out vec2 vLocal;                           // posição relativa ao centro, em pixels
+flat out vec4 vShape;
+flat out vec4 vParams;
+flat out vec4 vColor;
+void main() {
+    float extent = shape.z + 1.0;          // 1 pixel extra para o anti-aliasing
+    vLocal = corner * extent;
+    vShape = shape;
+    vParams = params;
+    vColor = instColor;
+    vec2 p = shape.xy + vLocal;
+    gl_Position = vec4(p / u_viewport * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+inline const char *const sdfFragmentShaderSource = R"(
+#version 400
+const float PI = 3.14159265;
+in vec2 vLocal;
+flat in vec4 vShape;
+flat in vec4 vParams;
+flat in vec4 vColor;
+out vec4 color;
+
+vec2 rotate(vec2 p, float a) {
+    float c = cos(a), s = sin(a);
+    return vec2(c * p.x + s * p.y, -s * p.x + c * p.y);
+}
+
+// Setor simétrico em torno de +y com meia abertura 'halfAngle'
+float sdSector(vec2 p, float r, float halfAngle) {
+    vec2 c = vec2(sin(halfAngle), cos(halfAngle));
+    p.x = abs(p.x);
+    float l = length(p) - r;
+    float m = length(p - c * clamp(dot(p, c), 0.0, r));
+    return max(l, m * sign(c.y * p.x - c.x * p.y));
+}
+
+// Estrela com a 1ª ponta em +x: dobra o plano na fatia [0, PI/n] e mede a aresta ponta -> vale
+float sdStar(vec2 p, float r, float n, float innerRatio) {
+    float an = PI / n;
+    float a = mod(atan(p.y, p.x) + an, 2.0 * an) - an; // ângulo até a ponta mais próxima
+    vec2 q = length(p) * vec2(cos(a), abs(sin(a)));
+    vec2 A = vec2(r, 0.0);
+    vec2 B = r * innerRatio * vec2(cos(an), sin(an));
+    vec2 e = B - A, w = q - A;
+    vec2 d = w - e * clamp(dot(w, e) / dot(e, e), 0.0, 1.0);
+    return e.x * w.y - e.y * w.x > 0.0 ? -length(d) : length(d);
+}
+
+void main() {
+    float r = vShape.z;
+    int kind = int(vParams.x + 0.5);
+    float d;
+    if (kind == 1)
+        d = sdSector(rotate(vLocal, vShape.w - 0.5 * PI), r, vParams.y);
+    else if (kind == 2)
+        d = sdStar(rotate(vLocal, vShape.w), r, vParams.y, vParams.z);
+    else
+        d = length(vLocal) - r;
+    // d está em pixels: cobertura linear em 1 pixel em torno da borda
+    float coverage = clamp(0.5 - d, 0.0, 1.0);
+    if (coverage <= 0.0)
+        discard;
+    color = vec4(vColor.rgb, vColor.a * coverage);
+}
+)";
+
+struct SdfRenderer
+{
+    GLuint program = 0, VAO = 0, quadVBO = 0, instanceVBO = 0;
+    GLint viewportLoc = -1;
+    size_t capacity = 0; // instâncias alocadas no instanceVBO
+    size_t count = 0;    // instâncias enviadas
+};
+
+inline SdfRenderer createSdfRenderer()
+{
+    SdfRenderer sdf;
+    sdf.program = buildShaderProgram(sdfVertexShaderSource, sdfFragmentShaderSource);
+    sdf.viewportLoc = glGetUniformLocation(sdf.program, "u_viewport");
+
+    float quad[] = {-1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f};
+    glGenVertexArrays(1, &sdf.VAO);
+    glGenBuffers(1, &sdf.quadVBO);
+    glGenBuffers(1, &sdf.instanceVBO);
+
+    glBindVertexArray(sdf.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, sdf.quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, sdf.instanceVBO);
+    for (int i = 0; i < 3; ++i) {
+        glVertexAttribPointer(1 + i, 4, GL_FLOAT, GL_FALSE, sizeof(SdfShape), (GLvoid *)(i * 4 * sizeof(float)));
+        glEnableVertexAttribArray(1 + i);
+        glVertexAttribDivisor(1 + i, 1);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return sdf;
+}
+
+// Envia as instâncias; o buffer só é realocado quando cresce
+inline void sdfUpload(SdfRenderer &sdf, const std::vector<SdfShape> &shapes)
+{
+    glBindBuffer(GL_ARRAY_BUFFER, sdf.instanceVBO);
+    if (shapes.size() > sdf.capacity) {
+        sdf.capacity = shapes.size();
+        glBufferData(GL_ARRAY_BUFFER, sdf.capacity * sizeof(SdfShape), shapes.data(), GL_DYNAMIC_DRAW);
+    } else if (!shapes.empty()) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, shapes.size() * sizeof(SdfShape), shapes.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    sdf.count = shapes.size();
+}
+
+// Desenha todas as instâncias em uma única chamada
+inline void sdfDraw(const SdfRenderer &sdf, float viewportWidth, float viewportHeight)
+{
+    if (sdf.count == 0)
+        return;
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glUseProgram(sdf.program);
+    glUniform2f(sdf.viewportLoc, viewportWidth, viewportHeight);
+    glBindVertexArray(sdf.VAO);
+    glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, 4, GLsizei(sdf.count));
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+}
+
+inline void deleteSdfRenderer(SdfRenderer &sdf)
+{
+    glDeleteVertexArrays(1, &sdf.VAO);
+    glDeleteBuffers(1, &sdf.quadVBO);
+    glDeleteBuffers(1, &sdf.instanceVBO);
+    glDeleteProgram(sdf.program);
+    sdf = SdfRenderer();
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+// Compilação de programas de shader usada pelo código comum em Commun/
+
+#include <iostream>
+#include <glad/glad.h>
+
+// Compila e linka vertex + fragment shader, retorna o ID do programa
+inline GLuint buildShaderProgram(const char *vertexSource, const char *fragmentSource)
+{
+    auto compileShader = [](GLenum type, const char *src) -> GLuint {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &src, nullptr);
+        glCompileShader(shader);
+        GLint success;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success) {
+            char infoLog[512];
+            glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+            std::cerr << "Erro ao compilar shader: " << infoLog << std::endl;
+        }
+        return shader;
+    };
+
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        char infoLog[512];
+        glGetProgramInfoLog(program, 512, nullptr, infoLog);
+        std::cerr << "Erro ao linkar programa: " << infoLog << std::endl;
+    }
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    return program;
+}
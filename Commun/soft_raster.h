@@ -0,0 +1,425 @@
+#pragma once
+
+// Rasterizador em CPU, sem GL nem GPU: recebe as mesmas primitivas que as atividades desenham
+// (GL_TRIANGLES, TRIANGLE_STRIP, TRIANGLE_FAN, LINES, LINE_STRIP, LINE_LOOP, POINTS), com cor por
+// vértice interpolada ou flat e viewport, e escreve em um buffer RGBA8 que pode ser salvo em PNG.
+//
+// Os desenhos só são registrados; softFlush() distribui os triângulos em tiles de 64x64 pixels e
+// rasteriza os tiles em paralelo (cada tile mantém a ordem dos desenhos), avaliando as funções
+// de aresta em 4 pixels por vez com as extensões de vetor do GCC/Clang (SSE/NEON).
+// Linhas viram retângulos com a largura da linha e pontos viram quadrados de pointSize pixels.
+// O y cresce para cima, como no GL; softSavePng grava a imagem com a linha de cima primeiro.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "png_image.h"
+
+// Mesmos valores das constantes do GL, para que o código possa passar GL_TRIANGLES etc.
+enum SoftPrimitive
+{
+    SOFT_POINTS = 0x0000,
+    SOFT_LINES = 0x0001,
+    SOFT_LINE_LOOP = 0x0002,
+    SOFT_LINE_STRIP = 0x0003,
+    SOFT_TRIANGLES = 0x0004,
+    SOFT_TRIANGLE_STRIP = 0x0005,
+    SOFT_TRIANGLE_FAN = 0x0006
+};
+
+enum SoftShading
+{
+    SOFT_SMOOTH, // cor interpolada entre os vértices
+    SOFT_FLAT    // cor do último vértice da primitiva (o "provoking vertex" do GL)
+};
+
+constexpr int SOFT_TILE = 64;
+
+// Vértice em coordenadas normalizadas (NDC), com cor
+struct SoftVertex
+{
+    float x, y;
+    float r, g, b, a;
+};
+
+// Triângulo já em pixels, com o retângulo do viewport em que foi desenhado
+struct SoftTriangle
+{
+    float x[3], y[3];
+    float color[3][4];
+    int clip[4]; // x0, y0, x1, y1 (x1/y1 exclusivos)
+    bool blend;
+};
+
+// Pool fixo de threads: run(n, f) chama f(0..n-1) distribuindo os índices entre as threads
+// (a thread que chama também trabalha) e volta quando todos terminam
+struct SoftThreadPool
+{
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake, finished;
+    std::function<void(int)> job;
+    std::atomic<int> next{0};
+    int jobCount = 0;
+    int generation = 0;
+    int running = 0;
+    bool stop = false;
+
+    void work()
+    {
+        for (int i = next++; i < jobCount; i = next++)
+            job(i);
+    }
+
+    void worker()
+    {
+        int seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stop || generation != seen; });
+                if (stop)
+                    return;
+                seen = generation;
+            }
+            work();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0)
+                finished.notify_one();
+        }
+    }
+
+    void start(int count)
+    {
+        for (int i = 0; i < count; ++i)
+            threads.emplace_back(&SoftThreadPool::worker, this);
+    }
+
+    void run(int count, const std::function<void(int)> &f)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = f;
+            jobCount = count;
+            next = 0;
+            running = int(threads.size());
+            generation++;
+        }
+        wake.notify_all();
+        work();
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return running == 0; });
+    }
+
+    ~SoftThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (std::thread &t : threads)
+            t.join();
+    }
+};
+
+struct SoftRaster
+{
+    int width = 0, height = 0;
+    std::vector<uint32_t> color; // RGBA8, linha 0 embaixo
+
+    int viewport[4] = {0, 0, 0, 0};
+    float lineWidth = 1.0f, pointSize = 1.0f;
+    SoftShading shading = SOFT_SMOOTH;
+    bool blend = false; // GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA
+
+    std::vector<SoftTriangle> triangles; // desenhos ainda não rasterizados
+    int tilesX = 0, tilesY = 0;
+    std::vector<std::vector<uint32_t>> bins; // índices dos triângulos por tile
+    SoftThreadPool *pool = nullptr;
+    int threadCount = 1;
+};
+
+// threads = 0 usa todos os núcleos
+inline void createSoftRaster(SoftRaster &raster, int width, int height, int threads = 0)
+{
+    raster.width = width;
+    raster.height = height;
+    raster.color.assign(size_t(width) * height, 0xFF000000u);
+    raster.viewport[0] = raster.viewport[1] = 0;
+    raster.viewport[2] = width;
+    raster.viewport[3] = height;
+    raster.tilesX = (width + SOFT_TILE - 1) / SOFT_TILE;
+    raster.tilesY = (height + SOFT_TILE - 1) / SOFT_TILE;
+    raster.bins.assign(size_t(raster.tilesX) * raster.tilesY, {});
+    raster.threadCount = threads > 0 ? threads : std::max(1, int(std::thread::hardware_concurrency()));
+    raster.pool = new SoftThreadPool();
+    raster.pool->start(raster.threadCount - 1);
+}
+
+inline void deleteSoftRaster(SoftRaster &raster)
+{
+    delete raster.pool;
+    raster.pool = nullptr;
+    raster.color.clear();
+    raster.triangles.clear();
+}
+
+inline void softViewport(SoftRaster &raster, int x, int y, int width, int height)
+{
+    raster.viewport[0] = x;
+    raster.viewport[1] = y;
+    raster.viewport[2] = width;
+    raster.viewport[3] = height;
+}
+
+inline uint32_t softPack(float r, float g, float b, float a)
+{
+    auto channel = [](float v) { return uint32_t(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f); };
+    return channel(r) | channel(g) << 8 | channel(b) << 16 | channel(a) << 24;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Montagem das primitivas
+
+inline void softPushTriangle(SoftRaster &raster, const float (&x)[3], const float (&y)[3], const SoftVertex *v[3])
+{
+    SoftTriangle t;
+    const SoftVertex *provoking = v[2];
+    for (int i = 0; i < 3; ++i) {
+        t.x[i] = x[i];
+        t.y[i] = y[i];
+        const SoftVertex *c = raster.shading == SOFT_FLAT ? provoking : v[i];
+        t.color[i][0] = c->r, t.color[i][1] = c->g, t.color[i][2] = c->b, t.color[i][3] = c->a;
+    }
+    // O viewport do GL recorta pelo volume de clip; aqui vira um retângulo de tesoura
+    const int *vp = raster.viewport;
+    t.clip[0] = std::max(0, vp[0]);
+    t.clip[1] = std::max(0, vp[1]);
+    t.clip[2] = std::min(raster.width, vp[0] + vp[2]);
+    t.clip[3] = std::min(raster.height, vp[1] + vp[3]);
+    t.blend = raster.blend;
+    raster.triangles.push_back(t);
+}
+
+inline void softToPixels(const SoftRaster &raster, const SoftVertex &v, float &x, float &y)
+{
+    x = raster.viewport[0] + (v.x + 1.0f) * 0.5f * raster.viewport[2];
+    y = raster.viewport[1] + (v.y + 1.0f) * 0.5f * raster.viewport[3];
+}
+
+inline void softTriangle(SoftRaster &raster, const SoftVertex &a, const SoftVertex &b, const SoftVertex &c)
+{
+    const SoftVertex *v[3] = {&a, &b, &c};
+    float x[3], y[3];
+    for (int i = 0; i < 3; ++i)
+        softToPixels(raster, *v[i], x[i], y[i]);
+    softPushTriangle(raster, x, y, v);
+}
+
+// Segmento como retângulo de lineWidth pixels (dois triângulos)
+inline void softLine(SoftRaster &raster, const SoftVertex &a, const SoftVertex &b)
+{
+    float ax, ay, bx, by;
+    softToPixels(raster, a, ax, ay);
+    softToPixels(raster, b, bx, by);
+    float dx = bx - ax, dy = by - ay;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length == 0.0f)
+        return;
+    float nx = -dy / length * raster.lineWidth * 0.5f, ny = dx / length * raster.lineWidth * 0.5f;
+    const SoftVertex *first[3] = {&a, &a, &b}, *second[3] = {&a, &b, &b};
+    float x1[3] = {ax + nx, ax - nx, bx - nx}, y1[3] = {ay + ny, ay - ny, by - ny};
+    float x2[3] = {ax + nx, bx - nx, bx + nx}, y2[3] = {ay + ny, by - ny, by + ny};
+    softPushTriangle(raster, x1, y1, first);
+    softPushTriangle(raster, x2, y2, second);
+}
+
+inline void softPoint(SoftRaster &raster, const SoftVertex &p)
+{
+    float x, y, h = raster.pointSize * 0.5f;
+    softToPixels(raster, p, x, y);
+    const SoftVertex *v[3] = {&p, &p, &p};
+    float x1[3] = {x - h, x + h, x + h}, y1[3] = {y - h, y - h, y + h};
+    float x2[3] = {x - h, x + h, x - h}, y2[3] = {y - h, y + h, y + h};
+    softPushTriangle(raster, x1, y1, v);
+    softPushTriangle(raster, x2, y2, v);
+}
+
+// Equivalente ao glDrawElements (indices = nullptr equivale ao glDrawArrays)
+inline void softDrawElements(SoftRaster &raster, int mode, const SoftVertex *vertices, const unsigned *indices,
+                             int count)
+{
+    auto at = [&](int i) -> const SoftVertex & { return vertices[indices ? indices[i] : unsigned(i)]; };
+    switch (mode) {
+    case SOFT_TRIANGLES:
+        for (int i = 0; i + 2 < count; i += 3)
+            softTriangle(raster, at(i), at(i + 1), at(i + 2));
+        break;
+    case SOFT_TRIANGLE_STRIP:
+        for (int i = 0; i + 2 < count; ++i)
+            if (i % 2 == 0)
+                softTriangle(raster, at(i), at(i + 1), at(i + 2));
+            else
+                softTriangle(raster, at(i + 1), at(i), at(i + 2));
+        break;
+    case SOFT_TRIANGLE_FAN:
+        for (int i = 1; i + 1 < count; ++i)
+            softTriangle(raster, at(0), at(i), at(i + 1));
+        break;
+    case SOFT_LINES:
+        for (int i = 0; i + 1 < count; i += 2)
+            softLine(raster, at(i), at(i + 1));
+        break;
+    case SOFT_LINE_STRIP:
+    case SOFT_LINE_LOOP:
+        for (int i = 0; i + 1 < count; ++i)
+            softLine(raster, at(i), at(i + 1));
+        if (mode == SOFT_LINE_LOOP && count > 2)
+            softLine(raster, at(count - 1), at(0));
+        break;
+    case SOFT_POINTS:
+        for (int i = 0; i < count; ++i)
+            softPoint(raster, at(i));
+        break;
+    }
+}
+
+inline void softDrawArrays(SoftRaster &raster, int mode, const SoftVertex *vertices, int count)
+{
+    softDrawElements(raster, mode, vertices, nullptr, count);
+}
+
+// ---------------------------------------------------------------------------------------------
+// Rasterização
+
+typedef float SoftF4 __attribute__((vector_size(16)));
+typedef int SoftI4 __attribute__((vector_size(16)));
+
+// Rasteriza um triângulo dentro do retângulo [x0, x1) x [y0, y1)
+inline void softRasterTriangle(SoftRaster &raster, const SoftTriangle &t, int x0, int y0, int x1, int y1)
+{
+    // Função de aresta i: oposta ao vértice i, positiva dentro para triângulos anti-horários
+    float area = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.y[1] - t.y[0]) * (t.x[2] - t.x[0]);
+    if (area == 0.0f)
+        return;
+    int order[3] = {0, 1, 2};
+    if (area < 0.0f) { // sem descarte de faces, como o padrão do GL
+        std::swap(order[1], order[2]);
+        area = -area;
+    }
+    float vx[3], vy[3], col[3][4];
+    for (int i = 0; i < 3; ++i) {
+        vx[i] = t.x[order[i]];
+        vy[i] = t.y[order[i]];
+        std::copy(t.color[order[i]], t.color[order[i]] + 4, col[i]);
+    }
+    float A[3], B[3], C[3];
+    bool topLeft[3];
+    for (int i = 0; i < 3; ++i) {
+        int a = (i + 1) % 3, b = (i + 2) % 3;
+        A[i] = vy[a] - vy[b];
+        B[i] = vx[b] - vx[a];
+        C[i] = vx[a] * vy[b] - vy[a] * vx[b];
+        // Regra top-left: pixels exatamente sobre a aresta só entram se ela for superior ou esquerda
+        topLeft[i] = (A[i] == 0.0f && B[i] < 0.0f) || A[i] > 0.0f;
+    }
+
+    int minX = std::max(x0, int(std::floor(std::min({vx[0], vx[1], vx[2]}))));
+    int maxX = std::min(x1 - 1, int(std::ceil(std::max({vx[0], vx[1], vx[2]}))));
+    int minY = std::max(y0, int(std::floor(std::min({vy[0], vy[1], vy[2]}))));
+    int maxY = std::min(y1 - 1, int(std::ceil(std::max({vy[0], vy[1], vy[2]}))));
+    if (minX > maxX || minY > maxY)
+        return;
+
+    const SoftF4 lane = {0.5f, 1.5f, 2.5f, 3.5f};
+    const float invArea = 1.0f / area;
+    SoftI4 bias[3];
+    for (int i = 0; i < 3; ++i)
+        bias[i] = SoftI4{0, 0, 0, 0} - (topLeft[i] ? 1 : 0);
+
+    for (int y = minY; y <= maxY; ++y) {
+        float py = y + 0.5f;
+        uint32_t *row = raster.color.data() + size_t(y) * raster.width;
+        for (int x = minX; x <= maxX; x += 4) {
+            SoftF4 px = float(x) + lane;
+            SoftF4 w0 = A[0] * px + (B[0] * py + C[0]);
+            SoftF4 w1 = A[1] * px + (B[1] * py + C[1]);
+            SoftF4 w2 = A[2] * px + (B[2] * py + C[2]);
+            SoftI4 inside = ((w0 > 0.0f) | ((w0 == 0.0f) & bias[0])) & ((w1 > 0.0f) | ((w1 == 0.0f) & bias[1])) &
+                            ((w2 > 0.0f) | ((w2 == 0.0f) & bias[2]));
+            if (!(inside[0] | inside[1] | inside[2] | inside[3]))
+                continue;
+            SoftF4 l0 = w0 * invArea, l1 = w1 * invArea, l2 = w2 * invArea;
+            SoftF4 channel[4];
+            for (int c = 0; c < 4; ++c)
+                channel[c] = l0 * col[0][c] + l1 * col[1][c] + l2 * col[2][c];
+            for (int k = 0; k < 4 && x + k <= maxX; ++k) {
+                if (!inside[k])
+                    continue;
+                uint32_t &dst = row[x + k];
+                if (t.blend) {
+                    float a = channel[3][k];
+                    float dr = (dst & 0xFF) / 255.0f, dg = (dst >> 8 & 0xFF) / 255.0f, db = (dst >> 16 & 0xFF) / 255.0f,
+                          da = (dst >> 24) / 255.0f;
+                    dst = softPack(channel[0][k] * a + dr * (1 - a), channel[1][k] * a + dg * (1 - a),
+                                   channel[2][k] * a + db * (1 - a), a * a + da * (1 - a));
+                } else {
+                    dst = softPack(channel[0][k], channel[1][k], channel[2][k], channel[3][k]);
+                }
+            }
+        }
+    }
+}
+
+// Distribui os triângulos pendentes nos tiles e rasteriza os tiles em paralelo
+inline void softFlush(SoftRaster &raster)
+{
+    if (raster.triangles.empty())
+        return;
+    for (std::vector<uint32_t> &bin : raster.bins)
+        bin.clear();
+    for (uint32_t i = 0; i < raster.triangles.size(); ++i) {
+        const SoftTriangle &t = raster.triangles[i];
+        int minX = std::max(t.clip[0], int(std::floor(std::min({t.x[0], t.x[1], t.x[2]}))));
+        int maxX = std::min(t.clip[2] - 1, int(std::ceil(std::max({t.x[0], t.x[1], t.x[2]}))));
+        int minY = std::max(t.clip[1], int(std::floor(std::min({t.y[0], t.y[1], t.y[2]}))));
+        int maxY = std::min(t.clip[3] - 1, int(std::ceil(std::max({t.y[0], t.y[1], t.y[2]}))));
+        if (minX > maxX || minY > maxY)
+            continue;
+        for (int ty = minY / SOFT_TILE; ty <= maxY / SOFT_TILE; ++ty)
+            for (int tx = minX / SOFT_TILE; tx <= maxX / SOFT_TILE; ++tx)
+                raster.bins[size_t(ty) * raster.tilesX + tx].push_back(i);
+    }
+    raster.pool->run(int(raster.bins.size()), [&raster](int tile) {
+        int tx = tile % raster.tilesX, ty = tile / raster.tilesX;
+        int x0 = tx * SOFT_TILE, y0 = ty * SOFT_TILE;
+        int x1 = std::min(x0 + SOFT_TILE, raster.width), y1 = std::min(y0 + SOFT_TILE, raster.height);
+        for (uint32_t index : raster.bins[tile]) {
+            const SoftTriangle &t = raster.triangles[index];
+            softRasterTriangle(raster, t, std::max(x0, t.clip[0]), std::max(y0, t.clip[1]), std::min(x1, t.clip[2]),
+                               std::min(y1, t.clip[3]));
+        }
+    });
+    raster.triangles.clear();
+}
+
+// Como o glClear: ignora o viewport e limpa a imagem inteira
+inline void softClear(SoftRaster &raster, float r, float g, float b, float a)
+{
+    softFlush(raster);
+    std::fill(raster.color.begin(), raster.color.end(), softPack(r, g, b, a));
+}
+
+inline bool softSavePng(SoftRaster &raster, const char *path)
+{
+    softFlush(raster);
+    return pngWrite(path, (const uint8_t *)raster.color.data(), raster.width, raster.height);
+}
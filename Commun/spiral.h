@@ -0,0 +1,9 @@
+#pragma once
+
+// Espiral de Arquimedes (r = b * theta) do Espiral.cpp, com o raio limitado a um máximo.
+// O MicroBenchmarks gera a mesma curva, então os dois leem as constantes daqui. Valores em NDC.
+
+constexpr float SPIRAL_MAX_RADIUS = 90.0f / 400.0f; // 0.225 (90 px na janela de 800 px do Espiral)
+constexpr float SPIRAL_THETA_TO_MAX = 100.0f;       // ângulo (rad) em que o raio chega ao máximo (~15,9 voltas)
+constexpr float SPIRAL_B = SPIRAL_MAX_RADIUS / SPIRAL_THETA_TO_MAX; // mais espaçado
+constexpr float SPIRAL_THETA_STEP = 0.35f;          // aumenta o passo angular para abrir mais
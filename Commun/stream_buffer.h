@@ -0,0 +1,103 @@
+#pragma once
+
+// Buffer de vértices que cresce por anexação: cada chamada envia apenas a cauda nova
+// (glBufferSubData). Quando a capacidade acaba, o buffer dobra e o conteúdo antigo é
+// copiado na própria GPU (glCopyBufferSubData), sem passar pela CPU.
+// Cada vértice tem 'components' floats no atributo 0 do VAO (3 para x, y, z como nas atividades).
+
+#include <glad/glad.h>
+
+struct StreamBuffer
+{
+    GLuint VAO = 0, VBO = 0;
+    GLint components = 3;
+    GLsizeiptr capacity = 0;  // vértices alocados
+    GLsizeiptr count = 0;     // vértices válidos
+    GLsizeiptr uploadedBytes = 0; // bytes enviados desde o último streamResetStats
+};
+
+inline void streamSetupAttribute(StreamBuffer &stream)
+{
+    glBindVertexArray(stream.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.VBO);
+    glVertexAttribPointer(0, stream.components, GL_FLOAT, GL_FALSE, stream.components * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+inline StreamBuffer createStreamBuffer(GLint components, GLsizeiptr initialCapacity = 1024)
+{
+    StreamBuffer stream;
+    stream.components = components;
+    stream.capacity = initialCapacity > 0 ? initialCapacity : 1;
+    glGenVertexArrays(1, &stream.VAO);
+    glGenBuffers(1, &stream.VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.VBO);
+    glBufferData(GL_ARRAY_BUFFER, stream.capacity * components * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    streamSetupAttribute(stream);
+    return stream;
+}
+
+// Garante espaço para 'required' vértices dobrando a capacidade e copiando na GPU
+inline void streamReserve(StreamBuffer &stream, GLsizeiptr required)
+{
+    if (required <= stream.capacity)
+        return;
+    GLsizeiptr newCapacity = stream.capacity;
+    while (newCapacity < required)
+        newCapacity *= 2;
+
+    GLsizeiptr vertexBytes = stream.components * sizeof(float);
+    GLuint newVBO;
+    glGenBuffers(1, &newVBO);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, newVBO);
+    glBufferData(GL_COPY_WRITE_BUFFER, newCapacity * vertexBytes, nullptr, GL_DYNAMIC_DRAW);
+    if (stream.count > 0) {
+        glBindBuffer(GL_COPY_READ_BUFFER, stream.VBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, stream.count * vertexBytes);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    glDeleteBuffers(1, &stream.VBO);
+    stream.VBO = newVBO;
+    stream.capacity = newCapacity;
+    streamSetupAttribute(stream); // o VAO passa a apontar para o novo VBO
+}
+
+// Anexa 'n' vértices ao final, enviando apenas esses dados
+inline void streamAppend(StreamBuffer &stream, const float *vertices, GLsizeiptr n)
+{
+    if (n <= 0)
+        return;
+    streamReserve(stream, stream.count + n);
+    GLsizeiptr vertexBytes = stream.components * sizeof(float);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.VBO);
+    glBufferSubData(GL_ARRAY_BUFFER, stream.count * vertexBytes, n * vertexBytes, vertices);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    stream.count += n;
+    stream.uploadedBytes += n * vertexBytes;
+}
+
+inline void streamClear(StreamBuffer &stream) { stream.count = 0; }
+
+inline void streamResetStats(StreamBuffer &stream) { stream.uploadedBytes = 0; }
+
+// Desenha exatamente os vértices gerados até agora
+inline void streamDraw(const StreamBuffer &stream, GLenum mode)
+{
+    if (stream.count == 0)
+        return;
+    glBindVertexArray(stream.VAO);
+    glDrawArrays(mode, 0, GLsizei(stream.count));
+    glBindVertexArray(0);
+}
+
+inline void deleteStreamBuffer(StreamBuffer &stream)
+{
+    glDeleteVertexArrays(1, &stream.VAO);
+    glDeleteBuffers(1, &stream.VBO);
+    stream = StreamBuffer();
+}
@@ -0,0 +1,1224 @@
+#pragma once
+
+// Importação de SVG para a cena binária (scene_file.h): lê o arquivo em blocos, transforma o
+// preenchimento de cada forma em triângulos e grava uma malha indexada com cor por vértice.
+//
+//   SvgImportOptions options;                   // tolerância de 0,25 px numa janela de 800 px
+//   SvgImportStats stats;
+//   if (svgImportScene("mapa.svg", "mapa.cena", options, stats))
+//       printf("%zu formas, %zu triângulos\n", stats.shapes, stats.triangles);
+//
+// Subconjunto aceito: <path> (M L H V C S Q T A Z, absolutos e relativos), <rect>, <circle>,
+// <ellipse>, <polygon> e <polyline>; cor de preenchimento em fill, fill-opacity, opacity e
+// style="fill:...", fill-rule (nonzero e evenodd), visibility e transform, herdados de <g>, e
+// display: none. O conteúdo de <defs>, <clipPath>, <mask>, <symbol> e <pattern> não é desenhado.
+// Contornos (stroke), gradientes, recortes, texto, <use> e cantos arredondados de <rect> são
+// ignorados.
+//
+// O arquivo passa por um buffer de SVG_BLOCK_SIZE bytes: a thread que lê só acha as tags e
+// acompanha os <g>; cada lote de formas vira um job (job_system.h) que interpreta os atributos,
+// aproxima as curvas por segmentos e triangula (triangulate.h). Só alguns blocos ficam na
+// memória, então o tamanho do SVG não pesa, só o da malha resultante. As curvas são divididas
+// em partes iguais, com o número de partes da fórmula de Wang: o desvio fica abaixo da
+// tolerância em pixels, medida na escala em que o viewBox cobre a janela inteira.
+//
+// O y do SVG cresce para baixo: a cena guarda -y, e os limites são os do viewBox (ou os dos
+// vértices, sem viewBox). A ordem dos triângulos é a do arquivo, então o que vem depois cobre
+// o que veio antes, como no SVG.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "job_system.h"
+#include "scene_file.h"
+#include "triangulate.h"
+
+constexpr size_t SVG_BLOCK_SIZE = 4 << 20;
+constexpr size_t SVG_BATCH_BYTES = 64 << 10;  // texto de SVG por job
+constexpr uint32_t SVG_MAX_CURVE_SEGMENTS = 1024;
+
+struct SvgImportOptions
+{
+    float tolerance = 0.25f;  // desvio máximo das curvas, em pixels
+    float pixels = 800.0f;    // lado da janela em que a tolerância é medida
+    int threads = 0;          // 0: um por núcleo
+};
+
+struct SvgImportStats
+{
+    size_t bytes = 0;
+    size_t shapes = 0;        // formas trianguladas
+    size_t skipped = 0;       // sem preenchimento, vazias ou inválidas
+    size_t vertices = 0, triangles = 0;
+    double readMs = 0.0;      // tempo da thread que lê (leitura e busca das tags)
+    double totalMs = 0.0;
+};
+
+// Vértice da cena importada: posição em float e cor em RGBA8
+struct SvgVertex
+{
+    float x, y;
+    uint8_t r, g, b, a;
+};
+static_assert(sizeof(SvgVertex) == 12, "SvgVertex deve ter 12 bytes");
+
+// Afim 2D: x' = a x + c y + e, y' = b x + d y + f
+struct SvgTransform
+{
+    float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f, e = 0.0f, f = 0.0f;
+};
+
+// Estado de preenchimento herdado pelos filhos de um <g>
+struct SvgStyle
+{
+    uint8_t r = 0, g = 0, b = 0; // o preenchimento padrão do SVG é preto
+    bool fill = true;
+    bool evenOdd = false;
+    bool visible = true;   // visibility (herdada; um filho pode voltar a visible)
+    bool displayed = true; // display: none some com o elemento e os filhos
+    float fillOpacity = 1.0f, opacity = 1.0f;
+    SvgTransform transform;
+};
+
+enum SvgShapeKind : uint8_t
+{
+    SVG_PATH,
+    SVG_RECT,
+    SVG_CIRCLE,
+    SVG_ELLIPSE,
+    SVG_POLYGON
+};
+
+// Uma forma achada pela thread que lê: o texto da tag (dentro do bloco) e o estilo herdado
+struct SvgElement
+{
+    const char *text;
+    uint32_t length;
+    SvgShapeKind kind;
+    uint32_t style; // índice em SvgBatch::styles
+};
+
+// Formas de um job e a malha que ele produz
+struct SvgBatch
+{
+    std::vector<SvgElement> elements;
+    std::vector<SvgStyle> styles;
+    float tolerance = 0.25f; // em unidades do SVG
+    std::vector<SvgVertex> vertices;
+    std::vector<uint32_t> indices; // relativos ao começo de 'vertices'
+    size_t shapes = 0, skipped = 0;
+    float bounds[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+};
+
+// --- Números, cores e transformações ---
+
+inline bool svgIsSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+inline const char *svgSkipSeparators(const char *p, const char *end)
+{
+    while (p < end && (svgIsSpace(*p) || *p == ','))
+        ++p;
+    return p;
+}
+
+// Número no formato do SVG ("-1.5e3", ".5", "10"), sem strtod: é a maior parte do arquivo e o
+// strtod depende da localidade (vírgula decimal em pt_BR)
+inline bool svgParseNumber(const char *&p, const char *end, float &out)
+{
+    static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+                                    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    const char *s = svgSkipSeparators(p, end);
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+'))
+        negative = *s++ == '-';
+    uint64_t mantissa = 0;
+    int exponent = 0, digits = 0;
+    for (; s < end && *s >= '0' && *s <= '9'; ++s, ++digits) {
+        if (mantissa < 100000000000000000ull)
+            mantissa = mantissa * 10 + uint64_t(*s - '0');
+        else
+            exponent++;
+    }
+    if (s < end && *s == '.') {
+        for (++s; s < end && *s >= '0' && *s <= '9'; ++s, ++digits) {
+            if (mantissa < 100000000000000000ull) {
+                mantissa = mantissa * 10 + uint64_t(*s - '0');
+                exponent--;
+            }
+        }
+    }
+    if (digits == 0)
+        return false;
+    if (s < end && (*s == 'e' || *s == 'E')) {
+        const char *e = s + 1;
+        bool negativeExponent = false;
+        if (e < end && (*e == '-' || *e == '+'))
+            negativeExponent = *e++ == '-';
+        if (e < end && *e >= '0' && *e <= '9') { // senão o 'e' não é expoente
+            int value = 0;
+            for (; e < end && *e >= '0' && *e <= '9'; ++e)
+                value = std::min(value * 10 + (*e - '0'), 1000);
+            exponent += negativeExponent ? -value : value;
+            s = e;
+        }
+    }
+    double value = double(mantissa);
+    if (exponent >= 0)
+        value *= exponent <= 18 ? powers[exponent] : std::pow(10.0, exponent);
+    else
+        value /= exponent >= -18 ? powers[-exponent] : std::pow(10.0, -exponent);
+    out = float(negative ? -value : value);
+    p = s;
+    return true;
+}
+
+// Flag de arco: um dígito só, que pode vir colado no próximo número ("a5 5 0 0110 10")
+inline bool svgParseFlag(const char *&p, const char *end, bool &out)
+{
+    const char *s = svgSkipSeparators(p, end);
+    if (s >= end || (*s != '0' && *s != '1'))
+        return false;
+    out = *s == '1';
+    p = s + 1;
+    return true;
+}
+
+inline bool svgEquals(const char *s, size_t length, const char *literal)
+{
+    return strlen(literal) == length && memcmp(s, literal, length) == 0;
+}
+
+inline int svgHexDigit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c = char(c | 0x20);
+    return c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+}
+
+// Valor de fill: #rgb, #rrggbb, rgb(r, g, b) (também em %), none e alguns nomes. Devolve false
+// para o que não entende (gradientes "url(#...)", por exemplo), que fica sem preenchimento.
+inline bool svgParseColor(const char *s, size_t length, SvgStyle &style)
+{
+    while (length && svgIsSpace(*s))
+        ++s, --length;
+    while (length && svgIsSpace(s[length - 1]))
+        --length;
+    style.fill = true;
+    if (length == 4 && s[0] == '#') {
+        int rgb[3];
+        for (int k = 0; k < 3; ++k)
+            if ((rgb[k] = svgHexDigit(s[1 + k])) < 0)
+                return false;
+        style.r = uint8_t(rgb[0] * 17), style.g = uint8_t(rgb[1] * 17), style.b = uint8_t(rgb[2] * 17);
+        return true;
+    }
+    if (length == 7 && s[0] == '#') {
+        int rgb[6];
+        for (int k = 0; k < 6; ++k)
+            if ((rgb[k] = svgHexDigit(s[1 + k])) < 0)
+                return false;
+        style.r = uint8_t(rgb[0] * 16 + rgb[1]), style.g = uint8_t(rgb[2] * 16 + rgb[3]);
+        style.b = uint8_t(rgb[4] * 16 + rgb[5]);
+        return true;
+    }
+    if (length > 4 && memcmp(s, "rgb(", 4) == 0) {
+        const char *p = s + 4, *end = s + length;
+        uint8_t *channels[3] = {&style.r, &style.g, &style.b};
+        for (uint8_t *channel : channels) {
+            float v;
+            if (!svgParseNumber(p, end, v))
+                return false;
+            if (p < end && *p == '%')
+                v *= 2.55f, ++p;
+            *channel = uint8_t(std::min(255.0f, std::max(0.0f, v)) + 0.5f);
+        }
+        return true;
+    }
+    static const struct
+    {
+        const char *name;
+        uint8_t r, g, b;
+    } names[] = {{"black", 0, 0, 0},       {"white", 255, 255, 255}, {"red", 255, 0, 0},
+                 {"green", 0, 128, 0},     {"blue", 0, 0, 255},      {"yellow", 255, 255, 0},
+                 {"gray", 128, 128, 128},  {"grey", 128, 128, 128},  {"orange", 255, 165, 0},
+                 {"purple", 128, 0, 128},  {"silver", 192, 192, 192}, {"navy", 0, 0, 128},
+                 {"teal", 0, 128, 128},    {"maroon", 128, 0, 0},    {"olive", 128, 128, 0},
+                 {"lime", 0, 255, 0},      {"aqua", 0, 255, 255},    {"fuchsia", 255, 0, 255},
+                 {"currentColor", 0, 0, 0}};
+    for (const auto &n : names)
+        if (svgEquals(s, length, n.name)) {
+            style.r = n.r, style.g = n.g, style.b = n.b;
+            return true;
+        }
+    style.fill = false;
+    return svgEquals(s, length, "none") || svgEquals(s, length, "transparent");
+}
+
+// m * n: aplica n e depois m
+inline SvgTransform svgMultiply(const SvgTransform &m, const SvgTransform &n)
+{
+    return {m.a * n.a + m.c * n.b, m.b * n.a + m.d * n.b, m.a * n.c + m.c * n.d,
+            m.b * n.c + m.d * n.d, m.a * n.e + m.c * n.f + m.e, m.b * n.e + m.d * n.f + m.f};
+}
+
+// Lista de transform: "translate(10 20) rotate(30) matrix(...)"; compõe sobre 't'
+inline bool svgParseTransform(const char *p, const char *end, SvgTransform &t)
+{
+    while (true) {
+        p = svgSkipSeparators(p, end);
+        if (p >= end)
+            return true;
+        const char *name = p;
+        while (p < end && *p != '(' && !svgIsSpace(*p))
+            ++p;
+        size_t nameLength = size_t(p - name);
+        while (p < end && *p != '(')
+            ++p;
+        if (p >= end)
+            return false;
+        ++p;
+        float v[6];
+        int count = 0;
+        while (count < 6 && svgParseNumber(p, end, v[count]))
+            count++;
+        p = svgSkipSeparators(p, end);
+        if (p >= end || *p != ')')
+            return false;
+        ++p;
+        SvgTransform m;
+        if (svgEquals(name, nameLength, "matrix") && count == 6) {
+            m = {v[0], v[1], v[2], v[3], v[4], v[5]};
+        } else if (svgEquals(name, nameLength, "translate") && count >= 1) {
+            m.e = v[0];
+            m.f = count > 1 ? v[1] : 0.0f;
+        } else if (svgEquals(name, nameLength, "scale") && count >= 1) {
+            m.a = v[0];
+            m.d = count > 1 ? v[1] : v[0];
+        } else if (svgEquals(name, nameLength, "rotate") && count >= 1) {
+            float angle = v[0] * float(M_PI / 180.0), cs = cosf(angle), sn = sinf(angle);
+            m = {cs, sn, -sn, cs, 0.0f, 0.0f};
+            if (count == 3) // rotate(a, cx, cy): em volta de (cx, cy)
+                m = svgMultiply(svgMultiply({1, 0, 0, 1, v[1], v[2]}, m), {1, 0, 0, 1, -v[1], -v[2]});
+        } else if (svgEquals(name, nameLength, "skewX") && count == 1) {
+            m.c = tanf(v[0] * float(M_PI / 180.0));
+        } else if (svgEquals(name, nameLength, "skewY") && count == 1) {
+            m.b = tanf(v[0] * float(M_PI / 180.0));
+        } else {
+            return false;
+        }
+        t = svgMultiply(t, m);
+    }
+}
+
+// Maior fator de escala da transformação (maior valor singular): a tolerância é dividida por
+// ele para as curvas serem aproximadas no espaço local
+inline float svgMaxScale(const SvgTransform &t)
+{
+    float p = t.a * t.a + t.b * t.b, q = t.c * t.c + t.d * t.d, r = t.a * t.c + t.b * t.d;
+    return sqrtf(0.5f * (p + q) + sqrtf(0.25f * (p - q) * (p - q) + r * r));
+}
+
+// --- Atributos ---
+
+// Próximo atributo name="value" (ou 'value') da tag; false no fim
+inline bool svgNextAttribute(const char *&p, const char *end, const char *&name, size_t &nameLength,
+                             const char *&value, size_t &valueLength)
+{
+    while (true) {
+        while (p < end && (svgIsSpace(*p) || *p == '/'))
+            ++p;
+        if (p >= end)
+            return false;
+        name = p;
+        while (p < end && *p != '=' && !svgIsSpace(*p) && *p != '/')
+            ++p;
+        nameLength = size_t(p - name);
+        while (p < end && svgIsSpace(*p))
+            ++p;
+        if (p >= end || *p != '=')
+            continue; // atributo sem valor
+        ++p;
+        while (p < end && svgIsSpace(*p))
+            ++p;
+        if (p >= end || (*p != '"' && *p != '\''))
+            continue;
+        const char *close = (const char *)memchr(p + 1, *p, size_t(end - p - 1));
+        if (!close)
+            return false;
+        value = p + 1;
+        valueLength = size_t(close - value);
+        p = close + 1;
+        return true;
+    }
+}
+
+// Aplica ao estilo um atributo de apresentação (fill, fill-opacity, opacity, fill-rule,
+// visibility, display ou transform); devolve false se não é um deles
+inline bool svgApplyStyleAttribute(SvgStyle &style, const char *name, size_t nameLength, const char *value,
+                                   size_t valueLength)
+{
+    const char *end = value + valueLength;
+    float v;
+    if (svgEquals(name, nameLength, "fill")) {
+        if (!svgParseColor(value, valueLength, style))
+            style.fill = false;
+    } else if (svgEquals(name, nameLength, "fill-opacity")) {
+        if (svgParseNumber(value, end, v))
+            style.fillOpacity = std::min(1.0f, std::max(0.0f, v));
+    } else if (svgEquals(name, nameLength, "opacity")) {
+        if (svgParseNumber(value, end, v))
+            style.opacity *= std::min(1.0f, std::max(0.0f, v));
+    } else if (svgEquals(name, nameLength, "fill-rule")) {
+        const char *s = svgSkipSeparators(value, end);
+        style.evenOdd = size_t(end - s) >= 7 && memcmp(s, "evenodd", 7) == 0;
+    } else if (svgEquals(name, nameLength, "visibility")) {
+        const char *s = svgSkipSeparators(value, end);
+        style.visible = !(size_t(end - s) >= 6 && (memcmp(s, "hidden", 6) == 0 || memcmp(s, "collap", 6) == 0));
+    } else if (svgEquals(name, nameLength, "display")) {
+        const char *s = svgSkipSeparators(value, end);
+        style.displayed = !(size_t(end - s) >= 4 && memcmp(s, "none", 4) == 0);
+    } else if (svgEquals(name, nameLength, "transform")) {
+        SvgTransform t = style.transform;
+        if (svgParseTransform(value, end, t))
+            style.transform = t;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// style="fill:#abc; opacity:.5": as mesmas propriedades, separadas por ';'
+inline void svgApplyStyleDeclarations(SvgStyle &style, const char *p, const char *end)
+{
+    while (p < end) {
+        const char *semicolon = (const char *)memchr(p, ';', size_t(end - p));
+        const char *declarationEnd = semicolon ? semicolon : end;
+        const char *colon = (const char *)memchr(p, ':', size_t(declarationEnd - p));
+        if (colon) {
+            const char *name = p, *nameEnd = colon;
+            while (name < nameEnd && svgIsSpace(*name))
+                ++name;
+            while (nameEnd > name && svgIsSpace(nameEnd[-1]))
+                --nameEnd;
+            if (!svgEquals(name, size_t(nameEnd - name), "transform")) // não é propriedade de CSS
+                svgApplyStyleAttribute(style, name, size_t(nameEnd - name), colon + 1,
+                                       size_t(declarationEnd - colon - 1));
+        }
+        p = declarationEnd + 1;
+    }
+}
+
+// --- Geometria ---
+
+// Memória de trabalho de uma thread (reaproveitada entre formas e lotes)
+struct SvgWorker
+{
+    std::vector<float> points;       // x, y no espaço local
+    std::vector<uint32_t> ringStarts; // ponto em que começa cada anel
+    std::vector<double> ringAreas;
+    std::vector<float> ringBounds;   // 4 por anel
+    std::vector<uint32_t> order, parent;
+    std::vector<int> winding;
+    std::vector<int32_t> owner;
+    std::vector<float> xyz;
+    std::vector<uint32_t> holeStarts, polygonIndices;
+    Triangulator triangulator;
+};
+
+inline void svgLineTo(SvgWorker &w, float x, float y)
+{
+    w.points.push_back(x);
+    w.points.push_back(y);
+}
+
+inline void svgBeginRing(SvgWorker &w)
+{
+    // Anel anterior vazio ou com um ponto só (M seguido de M): descartado
+    if (!w.ringStarts.empty() && w.points.size() / 2 - w.ringStarts.back() < 2)
+        w.points.resize(size_t(w.ringStarts.back()) * 2);
+    else
+        w.ringStarts.push_back(uint32_t(w.points.size() / 2));
+}
+
+// Partes iguais em t para um desvio de no máximo 'tolerance' (fórmula de Wang): n² >=
+// grau (grau - 1) / 8 * max |segunda diferença dos controles| / tolerância
+inline uint32_t svgCurveSegments(float secondDifference, float factor, float tolerance)
+{
+    float n = ceilf(sqrtf(factor * secondDifference / tolerance));
+    return n < 1.0f ? 1u : n > float(SVG_MAX_CURVE_SEGMENTS) ? SVG_MAX_CURVE_SEGMENTS : uint32_t(n);
+}
+
+inline void svgCubicTo(SvgWorker &w, float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3,
+                       float tolerance)
+{
+    float d = std::max(hypotf(x0 - 2 * x1 + x2, y0 - 2 * y1 + y2), hypotf(x1 - 2 * x2 + x3, y1 - 2 * y2 + y3));
+    uint32_t n = svgCurveSegments(d, 0.75f, tolerance);
+    for (uint32_t i = 1; i < n; ++i) {
+        float t = float(i) / float(n), s = 1.0f - t;
+        float b0 = s * s * s, b1 = 3 * s * s * t, b2 = 3 * s * t * t, b3 = t * t * t;
+        svgLineTo(w, b0 * x0 + b1 * x1 + b2 * x2 + b3 * x3, b0 * y0 + b1 * y1 + b2 * y2 + b3 * y3);
+    }
+    svgLineTo(w, x3, y3);
+}
+
+inline void svgQuadraticTo(SvgWorker &w, float x0, float y0, float x1, float y1, float x2, float y2, float tolerance)
+{
+    uint32_t n = svgCurveSegments(hypotf(x0 - 2 * x1 + x2, y0 - 2 * y1 + y2), 0.25f, tolerance);
+    for (uint32_t i = 1; i < n; ++i) {
+        float t = float(i) / float(n), s = 1.0f - t;
+        svgLineTo(w, s * s * x0 + 2 * s * t * x1 + t * t * x2, s * s * y0 + 2 * s * t * y1 + t * t * y2);
+    }
+    svgLineTo(w, x2, y2);
+}
+
+// Passos de ângulo para um arco de raio 'radius' com flecha de no máximo 'tolerance'
+inline uint32_t svgArcSegments(float sweep, float radius, float tolerance)
+{
+    float ratio = std::min(1.0f, tolerance / std::max(radius, 1e-12f));
+    float step = 2.0f * acosf(1.0f - ratio);
+    float n = ceilf(fabsf(sweep) / std::max(step, 1e-6f));
+    return n < 1.0f ? 1u : n > float(SVG_MAX_CURVE_SEGMENTS) ? SVG_MAX_CURVE_SEGMENTS : uint32_t(n);
+}
+
+// Arco elíptico na forma do SVG (pontas, raios, rotação e flags), convertido para centro e
+// ângulos como no apêndice B.2.4 da especificação
+inline void svgArcTo(SvgWorker &w, float x0, float y0, float rx, float ry, float rotation, bool largeArc, bool sweep,
+                     float x1, float y1, float tolerance)
+{
+    rx = fabsf(rx), ry = fabsf(ry);
+    if (x0 == x1 && y0 == y1)
+        return;
+    if (rx == 0.0f || ry == 0.0f) {
+        svgLineTo(w, x1, y1);
+        return;
+    }
+    double phi = double(rotation) * M_PI / 180.0, cs = cos(phi), sn = sin(phi);
+    double dx = (double(x0) - x1) / 2, dy = (double(y0) - y1) / 2;
+    double x1p = cs * dx + sn * dy, y1p = -sn * dx + cs * dy;
+    double rxs = double(rx) * rx, rys = double(ry) * ry;
+    double lambda = x1p * x1p / rxs + y1p * y1p / rys;
+    if (lambda > 1.0) { // raios pequenos demais: aumentados até o arco caber
+        double scale = sqrt(lambda);
+        rx = float(rx * scale), ry = float(ry * scale);
+        rxs = double(rx) * rx, rys = double(ry) * ry;
+    }
+    double numerator = rxs * rys - rxs * y1p * y1p - rys * x1p * x1p;
+    double denominator = rxs * y1p * y1p + rys * x1p * x1p;
+    double coefficient = denominator > 0.0 ? sqrt(std::max(0.0, numerator / denominator)) : 0.0;
+    if (largeArc == sweep)
+        coefficient = -coefficient;
+    double cxp = coefficient * rx * y1p / ry, cyp = -coefficient * ry * x1p / rx;
+    double cx = cs * cxp - sn * cyp + (double(x0) + x1) / 2, cy = sn * cxp + cs * cyp + (double(y0) + y1) / 2;
+    double theta = atan2((y1p - cyp) / ry, (x1p - cxp) / rx);
+    double delta = atan2((-y1p - cyp) / ry, (-x1p - cxp) / rx) - theta;
+    if (sweep && delta < 0.0)
+        delta += 2.0 * M_PI;
+    else if (!sweep && delta > 0.0)
+        delta -= 2.0 * M_PI;
+    uint32_t n = svgArcSegments(float(delta), std::max(rx, ry), tolerance);
+    for (uint32_t i = 1; i < n; ++i) {
+        double angle = theta + delta * double(i) / double(n);
+        double ex = rx * cos(angle), ey = ry * sin(angle);
+        svgLineTo(w, float(cs * ex - sn * ey + cx), float(sn * ex + cs * ey + cy));
+    }
+    svgLineTo(w, x1, y1);
+}
+
+inline void svgEllipse(SvgWorker &w, float cx, float cy, float rx, float ry, float tolerance)
+{
+    uint32_t n = std::max(3u, svgArcSegments(float(2.0 * M_PI), std::max(rx, ry), tolerance));
+    svgBeginRing(w);
+    for (uint32_t i = 0; i < n; ++i) {
+        double angle = 2.0 * M_PI * double(i) / double(n);
+        svgLineTo(w, cx + rx * float(cos(angle)), cy + ry * float(sin(angle)));
+    }
+}
+
+// Atributo d de um <path>: cada subcaminho vira um anel (fechado ou não, o preenchimento é o
+// mesmo). Para no primeiro erro, como os navegadores, e fica com o que já leu.
+inline void svgParsePathData(SvgWorker &w, const char *p, const char *end, float tolerance)
+{
+    float x = 0, y = 0, startX = 0, startY = 0, controlX = 0, controlY = 0;
+    char command = 0, previous = 0;
+    float v[7];
+    while (true) {
+        p = svgSkipSeparators(p, end);
+        if (p >= end)
+            return;
+        char c = *p;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            command = c;
+            ++p;
+        } else if (command == 0) {
+            return;
+        } else if (command == 'M' || command == 'm') {
+            command = command == 'M' ? 'L' : 'l'; // pares depois do M são retas
+        } else if (command == 'Z' || command == 'z') {
+            return;
+        }
+        bool relative = command >= 'a';
+        float ox = relative ? x : 0.0f, oy = relative ? y : 0.0f;
+        int arguments = 0;
+        switch (command | 0x20) {
+        case 'z':
+            x = startX, y = startY;
+            previous = 'z';
+            continue;
+        case 'm': case 'l': case 't':
+            arguments = 2;
+            break;
+        case 'h': case 'v':
+            arguments = 1;
+            break;
+        case 'c':
+            arguments = 6;
+            break;
+        case 's': case 'q':
+            arguments = 4;
+            break;
+        case 'a':
+            arguments = 7;
+            break;
+        default:
+            return;
+        }
+        bool flags[2] = {false, false};
+        for (int k = 0; k < arguments; ++k) {
+            bool ok = (command | 0x20) == 'a' && (k == 3 || k == 4) ? svgParseFlag(p, end, flags[k - 3])
+                                                                    : svgParseNumber(p, end, v[k]);
+            if (!ok)
+                return;
+        }
+        if (w.ringStarts.empty() && (command | 0x20) != 'm') // todo caminho começa com M
+            return;
+        if (previous == 'z' && (command | 0x20) != 'm') { // desenho depois do Z: novo anel no início
+            svgBeginRing(w);
+            svgLineTo(w, x, y);
+        }
+        char lower = char(command | 0x20);
+        // S e T refletem o controle anterior só se o comando anterior era da mesma família
+        bool smooth = (lower == 's' && (previous == 'c' || previous == 's')) ||
+                      (lower == 't' && (previous == 'q' || previous == 't'));
+        float reflectedX = smooth ? 2 * x - controlX : x, reflectedY = smooth ? 2 * y - controlY : y;
+        switch (lower) {
+        case 'm':
+            x = ox + v[0], y = oy + v[1];
+            startX = x, startY = y;
+            svgBeginRing(w);
+            svgLineTo(w, x, y);
+            break;
+        case 'l':
+            x = ox + v[0], y = oy + v[1];
+            svgLineTo(w, x, y);
+            break;
+        case 'h':
+            x = ox + v[0];
+            svgLineTo(w, x, y);
+            break;
+        case 'v':
+            y = oy + v[0];
+            svgLineTo(w, x, y);
+            break;
+        case 'c':
+            controlX = ox + v[2], controlY = oy + v[3];
+            svgCubicTo(w, x, y, ox + v[0], oy + v[1], controlX, controlY, ox + v[4], oy + v[5], tolerance);
+            x = ox + v[4], y = oy + v[5];
+            break;
+        case 's':
+            controlX = ox + v[0], controlY = oy + v[1];
+            svgCubicTo(w, x, y, reflectedX, reflectedY, controlX, controlY, ox + v[2], oy + v[3], tolerance);
+            x = ox + v[2], y = oy + v[3];
+            break;
+        case 'q':
+            controlX = ox + v[0], controlY = oy + v[1];
+            svgQuadraticTo(w, x, y, controlX, controlY, ox + v[2], oy + v[3], tolerance);
+            x = ox + v[2], y = oy + v[3];
+            break;
+        case 't':
+            controlX = reflectedX, controlY = reflectedY;
+            svgQuadraticTo(w, x, y, controlX, controlY, ox + v[0], oy + v[1], tolerance);
+            x = ox + v[0], y = oy + v[1];
+            break;
+        case 'a':
+            svgArcTo(w, x, y, v[0], v[1], v[2], flags[0], flags[1], ox + v[5], oy + v[6], tolerance);
+            x = ox + v[5], y = oy + v[6];
+            break;
+        }
+        previous = lower;
+    }
+}
+
+// Lista de pontos de <polygon>/<polyline>
+inline void svgParsePoints(SvgWorker &w, const char *p, const char *end)
+{
+    svgBeginRing(w);
+    float x, y;
+    while (svgParseNumber(p, end, x) && svgParseNumber(p, end, y))
+        svgLineTo(w, x, y);
+}
+
+inline bool svgPointInRing(const float *ring, uint32_t count, float x, float y)
+{
+    bool inside = false;
+    for (uint32_t i = 0, j = count - 1; i < count; j = i++) {
+        float xi = ring[i * 2], yi = ring[i * 2 + 1], xj = ring[j * 2], yj = ring[j * 2 + 1];
+        if ((yi > y) != (yj > y) && x < (xj - xi) * (y - yi) / (yj - yi) + xi)
+            inside = !inside;
+    }
+    return inside;
+}
+
+// Transforma os anéis da forma, separa contornos e furos pela regra de preenchimento e
+// triangula cada polígono, acrescentando os triângulos ao lote
+inline void svgFillRings(SvgWorker &w, const SvgStyle &style, SvgBatch &batch)
+{
+    uint32_t pointCount = uint32_t(w.points.size() / 2);
+    w.ringStarts.push_back(pointCount);
+    const SvgTransform &t = style.transform;
+    for (uint32_t i = 0; i < pointCount; ++i) {
+        float x = w.points[i * 2], y = w.points[i * 2 + 1];
+        w.points[i * 2] = t.a * x + t.c * y + t.e;
+        w.points[i * 2 + 1] = t.b * x + t.d * y + t.f;
+    }
+    // Área com sinal e caixa de cada anel; anéis sem área ficam de fora
+    uint32_t rings = 0;
+    w.order.clear();
+    w.ringAreas.clear();
+    w.ringBounds.clear();
+    for (uint32_t r = 0; r + 1 < w.ringStarts.size(); ++r) {
+        uint32_t begin = w.ringStarts[r], end = w.ringStarts[r + 1];
+        double area = 0.0;
+        float bounds[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+        for (uint32_t i = begin, j = end - 1; i < end; j = i++) {
+            float xi = w.points[i * 2], yi = w.points[i * 2 + 1];
+            area += (double(w.points[j * 2]) - xi) * (double(w.points[j * 2 + 1]) + yi);
+            bounds[0] = std::min(bounds[0], xi), bounds[1] = std::min(bounds[1], yi);
+            bounds[2] = std::max(bounds[2], xi), bounds[3] = std::max(bounds[3], yi);
+        }
+        w.ringAreas.push_back(area * 0.5);
+        w.ringBounds.insert(w.ringBounds.end(), bounds, bounds + 4);
+        if (end - begin >= 3 && area != 0.0)
+            w.order.push_back(r);
+        rings++;
+    }
+    if (w.order.empty()) {
+        batch.skipped++;
+        return;
+    }
+
+    // Pai de cada anel: o menor anel que o contém (maiores primeiro; com anéis que não se
+    // cruzam, o último que contém o primeiro ponto é o pai)
+    std::sort(w.order.begin(), w.order.end(),
+              [&](uint32_t a, uint32_t b) { return fabs(w.ringAreas[a]) > fabs(w.ringAreas[b]); });
+    w.parent.assign(rings, UINT32_MAX);
+    w.winding.assign(rings, 0);
+    w.owner.assign(rings, -1);
+    for (size_t i = 1; i < w.order.size(); ++i) {
+        uint32_t r = w.order[i];
+        float x = w.points[w.ringStarts[r] * 2], y = w.points[w.ringStarts[r] * 2 + 1];
+        for (size_t k = i; k-- > 0;) {
+            uint32_t q = w.order[k];
+            const float *b = &w.ringBounds[q * 4];
+            if (x < b[0] || x > b[2] || y < b[1] || y > b[3])
+                continue;
+            if (svgPointInRing(&w.points[w.ringStarts[q] * 2], w.ringStarts[q + 1] - w.ringStarts[q], x, y)) {
+                w.parent[r] = q;
+                break;
+            }
+        }
+    }
+    // Regra de preenchimento: evenodd conta anéis; nonzero soma os sentidos. Um anel preenchido
+    // dentro de região vazia começa um polígono; um vazio dentro de região cheia é furo dele.
+    struct Polygon
+    {
+        uint32_t outer;
+        std::vector<uint32_t> holes;
+    };
+    std::vector<Polygon> polygons;
+    for (uint32_t r : w.order) {
+        uint32_t p = w.parent[r];
+        int parentWinding = p == UINT32_MAX ? 0 : w.winding[p];
+        w.winding[r] = parentWinding + (style.evenOdd ? 1 : (w.ringAreas[r] > 0.0 ? 1 : -1));
+        bool filled = style.evenOdd ? (w.winding[r] & 1) != 0 : w.winding[r] != 0;
+        bool parentFilled = style.evenOdd ? (parentWinding & 1) != 0 : parentWinding != 0;
+        if (filled && !parentFilled) {
+            w.owner[r] = int32_t(polygons.size());
+            polygons.push_back({r, {}});
+        } else if (!filled && parentFilled) {
+            polygons[size_t(w.owner[p])].holes.push_back(r);
+        } else if (p != UINT32_MAX) {
+            w.owner[r] = w.owner[p]; // mesma região do pai: o anel não é borda
+        }
+    }
+
+    float alpha = style.fillOpacity * style.opacity * 255.0f + 0.5f;
+    SvgVertex color = {0.0f, 0.0f, style.r, style.g, style.b, uint8_t(alpha)};
+    for (const Polygon &polygon : polygons) {
+        w.xyz.clear();
+        w.holeStarts.clear();
+        auto addRing = [&](uint32_t r) {
+            for (uint32_t i = w.ringStarts[r]; i < w.ringStarts[r + 1]; ++i)
+                w.xyz.insert(w.xyz.end(), {w.points[i * 2], w.points[i * 2 + 1], 0.0f});
+        };
+        addRing(polygon.outer);
+        for (uint32_t hole : polygon.holes) {
+            w.holeStarts.push_back(uint32_t(w.xyz.size() / 3));
+            addRing(hole);
+        }
+        uint32_t count = uint32_t(w.xyz.size() / 3);
+        if (!triangulate(w.triangulator, w.xyz.data(), count, w.holeStarts, w.polygonIndices) ||
+            w.polygonIndices.empty())
+            continue;
+        uint32_t base = uint32_t(batch.vertices.size());
+        for (uint32_t i = 0; i < count; ++i) {
+            color.x = w.xyz[i * 3];
+            color.y = -w.xyz[i * 3 + 1];
+            batch.vertices.push_back(color);
+            batch.bounds[0] = std::min(batch.bounds[0], color.x), batch.bounds[1] = std::min(batch.bounds[1], color.y);
+            batch.bounds[2] = std::max(batch.bounds[2], color.x), batch.bounds[3] = std::max(batch.bounds[3], color.y);
+        }
+        for (uint32_t index : w.polygonIndices)
+            batch.indices.push_back(base + index);
+    }
+    batch.shapes++;
+}
+
+// Interpreta uma forma do lote: atributos, geometria e preenchimento
+inline void svgImportElement(SvgWorker &w, const SvgElement &element, SvgBatch &batch)
+{
+    SvgStyle style = batch.styles[element.style];
+    const char *p = element.text, *end = element.text + element.length;
+    while (p < end && !svgIsSpace(*p) && *p != '/') // nome da tag
+        ++p;
+    const char *name, *value, *data = nullptr, *dataEnd = nullptr;
+    size_t nameLength, valueLength;
+    float geometry[4] = {0.0f, 0.0f, 0.0f, 0.0f}; // x, y, largura, altura / cx, cy, rx, ry
+    const char *styleValue = nullptr;
+    size_t styleLength = 0;
+    while (svgNextAttribute(p, end, name, nameLength, value, valueLength)) {
+        if (svgApplyStyleAttribute(style, name, nameLength, value, valueLength))
+            continue;
+        const char *valueEnd = value + valueLength;
+        if (svgEquals(name, nameLength, "style")) {
+            styleValue = value, styleLength = valueLength;
+        } else if (svgEquals(name, nameLength, "d") || svgEquals(name, nameLength, "points")) {
+            data = value, dataEnd = valueEnd;
+        } else {
+            static const char *const names[][4] = {{"x", "y", "width", "height"},
+                                                   {"cx", "cy", "r", "r"},
+                                                   {"cx", "cy", "rx", "ry"}};
+            int row = element.kind == SVG_RECT ? 0 : element.kind == SVG_CIRCLE ? 1 : 2;
+            for (int k = 0; k < 4; ++k) {
+                const char *v = value; // o r do círculo vale para os dois raios
+                if (svgEquals(name, nameLength, names[row][k]))
+                    svgParseNumber(v, valueEnd, geometry[k]);
+            }
+        }
+    }
+    if (styleValue) // style vence os atributos de apresentação
+        svgApplyStyleDeclarations(style, styleValue, styleValue + styleLength);
+    if (!style.fill || !style.visible || !style.displayed || style.fillOpacity * style.opacity <= 0.0f) {
+        batch.skipped++;
+        return;
+    }
+
+    float scale = svgMaxScale(style.transform);
+    float tolerance = batch.tolerance / (scale > 0.0f ? scale : 1.0f);
+    w.points.clear();
+    w.ringStarts.clear();
+    switch (element.kind) {
+    case SVG_PATH:
+        if (data)
+            svgParsePathData(w, data, dataEnd, tolerance);
+        break;
+    case SVG_POLYGON:
+        if (data)
+            svgParsePoints(w, data, dataEnd);
+        break;
+    case SVG_RECT:
+        if (geometry[2] > 0.0f && geometry[3] > 0.0f) {
+            svgBeginRing(w);
+            svgLineTo(w, geometry[0], geometry[1]);
+            svgLineTo(w, geometry[0] + geometry[2], geometry[1]);
+            svgLineTo(w, geometry[0] + geometry[2], geometry[1] + geometry[3]);
+            svgLineTo(w, geometry[0], geometry[1] + geometry[3]);
+        }
+        break;
+    case SVG_CIRCLE:
+    case SVG_ELLIPSE:
+        if (geometry[2] > 0.0f && geometry[3] > 0.0f)
+            svgEllipse(w, geometry[0], geometry[1], geometry[2], geometry[3], tolerance);
+        break;
+    }
+    if (!w.ringStarts.empty() && w.points.size() / 2 - w.ringStarts.back() < 2) // último anel vazio
+        w.points.resize(size_t(w.ringStarts.back()) * 2), w.ringStarts.pop_back();
+    if (w.ringStarts.empty()) {
+        batch.skipped++;
+        return;
+    }
+    svgFillRings(w, style, batch);
+}
+
+inline void svgImportBatch(SvgBatch &batch)
+{
+    static thread_local SvgWorker worker;
+    for (const SvgElement &element : batch.elements)
+        svgImportElement(worker, element, batch);
+    batch.elements.clear(); // o texto do bloco pode ser liberado
+    batch.elements.shrink_to_fit();
+}
+
+// --- Leitura em blocos ---
+
+// Um bloco do arquivo e os lotes de formas que estão nele
+struct SvgBlock
+{
+    std::vector<char> text;
+    JobCounter done;
+};
+
+struct SvgReader
+{
+    std::vector<SvgStyle> styles = {SvgStyle()}; // pilha de <g>; a base é o padrão do SVG
+    bool root = false;     // já passou pelo <svg>
+    int hiddenDepth = 0;   // > 0: dentro de <defs>, <clipPath>... ou de um <g> com display: none
+    bool hasViewBox = false;
+    float viewBox[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float tolerance = 0.25f; // em unidades do SVG
+    SvgImportOptions options;
+    std::vector<std::unique_ptr<SvgBatch>> batches;
+    SvgBatch *current = nullptr;
+    size_t currentBytes = 0;
+};
+
+// <svg>: viewBox (ou width/height) define a escala em que a tolerância em pixels é medida
+inline void svgReadRoot(SvgReader &reader, const char *p, const char *end)
+{
+    const char *name, *value;
+    size_t nameLength, valueLength;
+    float width = 0.0f, height = 0.0f;
+    while (svgNextAttribute(p, end, name, nameLength, value, valueLength)) {
+        const char *valueEnd = value + valueLength;
+        if (svgEquals(name, nameLength, "viewBox")) {
+            float v[4];
+            int count = 0;
+            while (count < 4 && svgParseNumber(value, valueEnd, v[count]))
+                count++;
+            if (count == 4 && v[2] > 0.0f && v[3] > 0.0f) {
+                memcpy(reader.viewBox, v, sizeof(v));
+                reader.hasViewBox = true;
+            }
+        } else if (svgEquals(name, nameLength, "width")) {
+            svgParseNumber(value, valueEnd, width);
+        } else if (svgEquals(name, nameLength, "height")) {
+            svgParseNumber(value, valueEnd, height);
+        }
+    }
+    if (!reader.hasViewBox && width > 0.0f && height > 0.0f) {
+        float v[4] = {0.0f, 0.0f, width, height};
+        memcpy(reader.viewBox, v, sizeof(v));
+        reader.hasViewBox = true;
+    }
+    // Sem tamanho, 1 unidade = 1 pixel (o padrão do SVG)
+    float unitsPerPixel = reader.hasViewBox ? std::min(reader.viewBox[2], reader.viewBox[3]) / reader.options.pixels : 1.0f;
+    reader.tolerance = reader.options.tolerance * unitsPerPixel;
+}
+
+inline SvgShapeKind svgShapeKind(const char *name, size_t length, bool &shape)
+{
+    shape = true;
+    if (svgEquals(name, length, "path"))
+        return SVG_PATH;
+    if (svgEquals(name, length, "rect"))
+        return SVG_RECT;
+    if (svgEquals(name, length, "circle"))
+        return SVG_CIRCLE;
+    if (svgEquals(name, length, "ellipse"))
+        return SVG_ELLIPSE;
+    if (svgEquals(name, length, "polygon") || svgEquals(name, length, "polyline"))
+        return SVG_POLYGON;
+    shape = false;
+    return SVG_PATH;
+}
+
+// Contêineres cujas formas não são desenhadas no lugar em que aparecem
+inline bool svgIsHiddenContainer(const char *name, size_t length)
+{
+    static const char *const names[] = {"defs", "clipPath", "mask", "symbol", "pattern", "marker",
+                                        "linearGradient", "radialGradient", "filter"};
+    for (const char *hidden : names)
+        if (svgEquals(name, length, hidden))
+            return true;
+    return false;
+}
+
+inline void svgSubmitBatch(SvgReader &reader, JobSystem &jobs, SvgBlock &block)
+{
+    if (!reader.current)
+        return;
+    SvgBatch *batch = reader.current;
+    jobSubmit(jobs, [batch] { svgImportBatch(*batch); }, &block.done);
+    reader.current = nullptr;
+    reader.currentBytes = 0;
+}
+
+// Lotes não atravessam blocos: o texto das formas é do bloco, que é liberado quando eles terminam
+inline size_t svgFinishBlock(SvgReader &reader, JobSystem &jobs, SvgBlock &block, size_t used)
+{
+    svgSubmitBatch(reader, jobs, block);
+    return used;
+}
+
+// Acha as tags completas do bloco, acompanha a pilha de <g> e junta as formas em lotes;
+// devolve onde começa a tag incompleta do fim (o resto vai para o próximo bloco)
+inline size_t svgScanBlock(SvgReader &reader, JobSystem &jobs, SvgBlock &block)
+{
+    const char *begin = block.text.data(), *end = begin + block.text.size(), *p = begin;
+    while (true) {
+        const char *open = (const char *)memchr(p, '<', size_t(end - p));
+        if (!open)
+            break;
+        const char *q = open + 1;
+        if (end - q >= 3 && memcmp(q, "!--", 3) == 0) { // comentário
+            const char *close = nullptr;
+            for (const char *s = q + 3; (s = (const char *)memchr(s, '-', size_t(end - s))) != nullptr; ++s)
+                if (end - s >= 3 && s[1] == '-' && s[2] == '>') {
+                    close = s + 2;
+                    break;
+                }
+            if (!close)
+                return svgFinishBlock(reader, jobs, block, size_t(open - begin));
+            p = close + 1;
+            continue;
+        }
+        if (end - q >= 8 && memcmp(q, "![CDATA[", 8) == 0) {
+            const char *close = nullptr;
+            for (const char *s = q + 8; (s = (const char *)memchr(s, ']', size_t(end - s))) != nullptr; ++s)
+                if (end - s >= 3 && s[1] == ']' && s[2] == '>') {
+                    close = s + 2;
+                    break;
+                }
+            if (!close)
+                return svgFinishBlock(reader, jobs, block, size_t(open - begin));
+            p = close + 1;
+            continue;
+        }
+        // Fim da tag, pulando o que está entre aspas (o d de um path é quase todo o arquivo)
+        const char *close = q;
+        while (close < end && *close != '>') {
+            if (*close == '"' || *close == '\'') {
+                const char *quote = (const char *)memchr(close + 1, *close, size_t(end - close - 1));
+                if (!quote)
+                    return svgFinishBlock(reader, jobs, block, size_t(open - begin));
+                close = quote;
+            }
+            ++close;
+        }
+        if (close >= end)
+            return svgFinishBlock(reader, jobs, block, size_t(open - begin));
+        p = close + 1;
+        if (*q == '?' || *q == '!') // <?xml ...?>, <!DOCTYPE ...>
+            continue;
+        bool closing = *q == '/';
+        if (closing)
+            ++q;
+        const char *name = q;
+        while (q < close && !svgIsSpace(*q) && *q != '/')
+            ++q;
+        if (const char *colon = (const char *)memchr(name, ':', size_t(q - name))) // svg:path
+            name = colon + 1;
+        size_t nameLength = size_t(q - name);
+        bool selfClosing = close[-1] == '/';
+        // Conteúdo que não é desenhado onde está (só referenciado por url(#...) ou <use>): tudo
+        // até a tag que fecha o contêiner é ignorado, contando as tags abertas no meio
+        if (reader.hiddenDepth > 0) {
+            if (closing)
+                reader.hiddenDepth--;
+            else if (!selfClosing)
+                reader.hiddenDepth++;
+            continue;
+        }
+        if (!closing && !selfClosing && svgIsHiddenContainer(name, nameLength)) {
+            reader.hiddenDepth = 1;
+            continue;
+        }
+        if (svgEquals(name, nameLength, "g")) {
+            if (closing) {
+                if (reader.styles.size() > 1)
+                    reader.styles.pop_back();
+            } else if (!selfClosing) {
+                SvgStyle style = reader.styles.back();
+                const char *a = q, *attributeName, *value, *styleValue = nullptr;
+                size_t attributeLength, valueLength, styleLength = 0;
+                while (svgNextAttribute(a, close, attributeName, attributeLength, value, valueLength)) {
+                    if (svgEquals(attributeName, attributeLength, "style"))
+                        styleValue = value, styleLength = valueLength;
+                    else
+                        svgApplyStyleAttribute(style, attributeName, attributeLength, value, valueLength);
+                }
+                if (styleValue)
+                    svgApplyStyleDeclarations(style, styleValue, styleValue + styleLength);
+                if (!style.displayed)
+                    reader.hiddenDepth = 1;
+                else
+                    reader.styles.push_back(style);
+            }
+            continue;
+        }
+        if (closing)
+            continue;
+        if (!reader.root && svgEquals(name, nameLength, "svg")) {
+            svgReadRoot(reader, q, close);
+            reader.root = true;
+            continue;
+        }
+        bool shape;
+        SvgShapeKind kind = svgShapeKind(name, nameLength, shape);
+        if (!shape)
+            continue;
+        if (!reader.current) {
+            reader.batches.push_back(std::unique_ptr<SvgBatch>(new SvgBatch));
+            reader.current = reader.batches.back().get();
+            reader.current->tolerance = reader.tolerance;
+        }
+        SvgBatch &batch = *reader.current;
+        // Formas seguidas com o mesmo estilo herdado dividem a cópia
+        const SvgStyle &inherited = reader.styles.back();
+        if (batch.styles.empty() || memcmp(&batch.styles.back(), &inherited, sizeof(SvgStyle)) != 0)
+            batch.styles.push_back(inherited);
+        batch.elements.push_back({name, uint32_t(close - name), kind, uint32_t(batch.styles.size() - 1)});
+        reader.currentBytes += size_t(close - open);
+        if (reader.currentBytes >= SVG_BATCH_BYTES)
+            svgSubmitBatch(reader, jobs, block);
+    }
+    return svgFinishBlock(reader, jobs, block, block.text.size());
+}
+
+struct SvgScene
+{
+    std::vector<SvgVertex> vertices;
+    std::vector<uint32_t> indices;
+    float bounds[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+};
+
+// Lê e triangula o SVG inteiro
+inline bool svgImport(const char *path, const SvgImportOptions &options, SvgScene &scene, SvgImportStats &stats)
+{
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "svg: não foi possível abrir %s\n", path);
+        return false;
+    }
+    JobSystem jobs;
+    jobSystemStart(jobs, options.threads);
+    SvgReader reader;
+    reader.options = options;
+    reader.tolerance = options.tolerance;
+    // Blocos em andamento: com mais do que isso a leitura espera o mais antigo terminar
+    size_t maxBlocks = jobs.workers.size() + 1;
+    std::deque<std::unique_ptr<SvgBlock>> blocks;
+    std::vector<char> carry;
+    double readMs = 0.0;
+    bool eof = false;
+    while (!eof) {
+        auto readStart = Clock::now();
+        std::unique_ptr<SvgBlock> block(new SvgBlock);
+        block->text.resize(carry.size() + SVG_BLOCK_SIZE);
+        memcpy(block->text.data(), carry.data(), carry.size());
+        size_t got = fread(block->text.data() + carry.size(), 1, SVG_BLOCK_SIZE, f);
+        stats.bytes += got;
+        eof = got < SVG_BLOCK_SIZE;
+        block->text.resize(carry.size() + got);
+        size_t used = svgScanBlock(reader, jobs, *block);
+        carry.assign(block->text.begin() + long(used), block->text.end());
+        readMs += std::chrono::duration<double, std::milli>(Clock::now() - readStart).count();
+        blocks.push_back(std::move(block));
+        while (blocks.size() > maxBlocks) {
+            jobWait(jobs, blocks.front()->done);
+            blocks.pop_front();
+        }
+    }
+    fclose(f);
+    for (std::unique_ptr<SvgBlock> &block : blocks)
+        jobWait(jobs, block->done);
+    blocks.clear();
+    jobSystemStop(jobs);
+    if (!carry.empty())
+        fprintf(stderr, "svg: %s termina no meio de uma tag\n", path);
+
+    // Junta os lotes na ordem do arquivo
+    size_t vertexCount = 0, indexCount = 0;
+    float bounds[4] = {INFINITY, INFINITY, -INFINITY, -INFINITY};
+    for (const std::unique_ptr<SvgBatch> &batch : reader.batches) {
+        vertexCount += batch->vertices.size();
+        indexCount += batch->indices.size();
+        stats.shapes += batch->shapes;
+        stats.skipped += batch->skipped;
+        bounds[0] = std::min(bounds[0], batch->bounds[0]), bounds[1] = std::min(bounds[1], batch->bounds[1]);
+        bounds[2] = std::max(bounds[2], batch->bounds[2]), bounds[3] = std::max(bounds[3], batch->bounds[3]);
+    }
+    if (vertexCount > UINT32_MAX) {
+        fprintf(stderr, "svg: %zu vértices não cabem em índices de 32 bits\n", vertexCount);
+        return false;
+    }
+    scene.vertices.resize(vertexCount);
+    scene.indices.resize(indexCount);
+    size_t vertexOffset = 0, indexOffset = 0;
+    for (std::unique_ptr<SvgBatch> &batch : reader.batches) {
+        std::copy(batch->vertices.begin(), batch->vertices.end(), scene.vertices.begin() + long(vertexOffset));
+        for (uint32_t index : batch->indices)
+            scene.indices[indexOffset++] = uint32_t(vertexOffset) + index;
+        vertexOffset += batch->vertices.size();
+        batch.reset(); // libera enquanto junta: o pico de memória fica perto de uma cópia da malha
+    }
+    if (reader.hasViewBox) {
+        const float *v = reader.viewBox;
+        float b[4] = {v[0], -(v[1] + v[3]), v[0] + v[2], -v[1]};
+        memcpy(scene.bounds, b, sizeof(b));
+    } else if (vertexCount) {
+        memcpy(scene.bounds, bounds, sizeof(bounds));
+    }
+    stats.vertices = vertexCount;
+    stats.triangles = indexCount / 3;
+    stats.readMs = readMs;
+    stats.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return true;
+}
+
+// Importa e grava a cena: vértices SvgVertex e índices de 16 ou 32 bits
+inline bool svgImportScene(const char *svgPath, const char *scenePath, const SvgImportOptions &options,
+                           SvgImportStats &stats)
+{
+    SvgScene scene;
+    if (!svgImport(svgPath, options, scene, stats))
+        return false;
+    if (scene.indices.empty()) {
+        fprintf(stderr, "svg: nenhuma forma preenchida em %s\n", svgPath);
+        return false;
+    }
+    std::vector<SceneChunkData> chunks = {
+        {sceneChunk(SCENE_VERTICES, uint32_t(scene.vertices.size()), sizeof(SvgVertex),
+                    {sceneAttribute(SCENE_POSITION, 2, GL_FLOAT, 0),
+                     sceneAttribute(SCENE_COLOR, 4, GL_UNSIGNED_BYTE, 8, true)}),
+         scene.vertices.data()}};
+    std::vector<uint16_t> shortIndices;
+    if (scene.vertices.size() <= 65536) {
+        shortIndices.assign(scene.indices.begin(), scene.indices.end());
+        chunks.push_back({sceneIndexChunk(uint32_t(shortIndices.size()), GL_UNSIGNED_SHORT), shortIndices.data()});
+    } else {
+        chunks.push_back({sceneIndexChunk(uint32_t(scene.indices.size()), GL_UNSIGNED_INT), scene.indices.data()});
+    }
+    return sceneSave(scenePath, GL_TRIANGLES, scene.bounds, chunks);
+}
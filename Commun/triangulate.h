@@ -0,0 +1,580 @@
+#pragma once
+
+// Triangulação de polígonos simples, côncavos e com furos, por recorte de orelhas (ear
+// clipping). A saída são índices de triângulos sobre os próprios vértices de entrada, prontos
+// para um EBO ou para o drawListAddMesh (draw_list.h).
+//
+//   std::vector<float> xyz = {...};         // contorno e depois cada furo, (x, y, z); z é ignorado
+//   std::vector<uint32_t> holes = {40, 52}; // vértice em que começa cada furo
+//   std::vector<uint32_t> indices;
+//   triangulate(xyz.data(), xyz.size() / 3, holes, indices);
+//   drawListAddMesh(list, GL_TRIANGLES, xyz.data(), xyz.size() / 3, indices.data(), indices.size());
+//
+// O sentido de cada anel não importa (o contorno é posto no anti-horário e os furos no horário).
+// Cada furo é ligado ao contorno por uma ponte (dois vértices duplicados), como no earcut, e o
+// polígono resultante é recortado orelha por orelha. Testar uma orelha é ver se algum vértice
+// côncavo cai dentro dela: os côncavos ficam numa grade uniforme (hash espacial) e o teste só
+// olha as células que o triângulo atravessa, em vez de todos os vértices. As orelhas saem de
+// uma fila (só os vizinhos de um recorte são testados de novo), a de diagonal mais curta
+// primeiro. Com as duas coisas o recorte vai de O(n²) para perto de O(n) em polígonos comuns.
+//
+// Entrada que se cruza não tem triangulação válida: depois de tentar desfazer cruzamentos
+// locais, o recorte força orelhas e sempre termina, com triângulos sobrepostos nesse trecho.
+// Cada furo custa uma busca linear no contorno (a ponte), então milhares de furos pesam mais
+// do que milhares de vértices.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+struct TriangulationNode
+{
+    double x, y;
+    uint32_t index;       // vértice de entrada
+    uint32_t prev, next;  // lista circular do polígono
+    bool reflex;          // côncavo (ou colinear): pode estar dentro de uma orelha
+    bool removed;
+    bool listed;          // está na grade ou na lista de côncavos que surgiram depois dela
+};
+
+// Côncavo guardado na grade: a posição vem junto para a caixa da orelha descartar sem ler o nó
+struct TriangulationPoint
+{
+    float x, y;
+    uint32_t node;
+};
+
+constexpr int TRIANGULATION_BUCKETS = 64;
+
+// Vértice candidato a orelha na fila
+struct TriangulationCandidate
+{
+    double key;
+    uint32_t node;
+};
+
+// Estado reaproveitável entre chamadas (os vetores mantêm a capacidade)
+struct Triangulator
+{
+    std::vector<TriangulationNode> nodes;
+    bool useSpatialHash = true; // false: testa todos os côncavos (para comparar)
+
+    // Grade dos côncavos: células em faixas de cellItems (cellStart..cellStart+cellCount)
+    double minX = 0.0, minY = 0.0, cellSize = 1.0;
+    int cols = 0, rows = 0;
+    std::vector<uint32_t> cellStart, cellCount;
+    std::vector<TriangulationPoint> cellItems;
+    std::vector<TriangulationPoint> lateReflex; // ficaram côncavos depois de montar a grade
+    std::vector<TriangulationPoint> reflexNodes; // todos os côncavos (limpos aos poucos)
+    // Fila de orelhas em baldes pela ordem de grandeza da diagonal (pilha em cada balde)
+    std::vector<TriangulationCandidate> earBuckets[TRIANGULATION_BUCKETS];
+    int lowestBucket = TRIANGULATION_BUCKETS;
+    size_t reflexAlive = 0;
+};
+
+inline double triCross(const TriangulationNode &a, const TriangulationNode &b, const TriangulationNode &c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+// Ponto dentro (ou na borda) do triângulo a, b, c no sentido anti-horário
+inline bool triPointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py)
+{
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) && (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+inline bool triEquals(const TriangulationNode &a, const TriangulationNode &b)
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+inline void triSetReflex(Triangulator &t, uint32_t i)
+{
+    TriangulationNode &n = t.nodes[i];
+    bool reflex = triCross(t.nodes[n.prev], n, t.nodes[n.next]) <= 0.0;
+    if (reflex == n.reflex)
+        return;
+    n.reflex = reflex;
+    if (reflex) {
+        t.reflexAlive++;
+        if (!n.listed) { // raro: só nas passadas de correção
+            n.listed = true;
+            t.lateReflex.push_back({float(n.x), float(n.y), i});
+            t.reflexNodes.push_back({float(n.x), float(n.y), i});
+        }
+    } else {
+        t.reflexAlive--;
+    }
+}
+
+inline void triRemove(Triangulator &t, uint32_t i)
+{
+    TriangulationNode &n = t.nodes[i];
+    t.nodes[n.prev].next = n.next;
+    t.nodes[n.next].prev = n.prev;
+    n.removed = true;
+    if (n.reflex) {
+        n.reflex = false;
+        t.reflexAlive--;
+    }
+}
+
+// Anel de entrada como lista circular no sentido pedido; devolve o último nó (ou UINT32_MAX)
+inline uint32_t triLinkRing(Triangulator &t, const float *xyz, uint32_t begin, uint32_t end, bool counterClockwise)
+{
+    double area = 0.0;
+    for (uint32_t i = begin, j = end - 1; i < end; j = i++)
+        area += double(xyz[j * 3]) * xyz[i * 3 + 1] - double(xyz[i * 3]) * xyz[j * 3 + 1];
+    bool forward = (area > 0.0) == counterClockwise;
+    uint32_t first = UINT32_MAX, last = UINT32_MAX;
+    for (uint32_t k = 0; k < end - begin; ++k) {
+        uint32_t v = forward ? begin + k : end - 1 - k;
+        TriangulationNode n = {xyz[v * 3], xyz[v * 3 + 1], v, 0, 0, false, false, false};
+        if (last != UINT32_MAX && triEquals(t.nodes[last], n))
+            continue; // ponto repetido (clique duplo)
+        uint32_t id = uint32_t(t.nodes.size());
+        if (last == UINT32_MAX) {
+            n.prev = n.next = id;
+            first = id;
+        } else {
+            n.prev = last;
+            n.next = first;
+            t.nodes[last].next = id;
+            t.nodes[first].prev = id;
+        }
+        t.nodes.push_back(n);
+        last = id;
+    }
+    if (last != UINT32_MAX && last != first && triEquals(t.nodes[last], t.nodes[first])) {
+        uint32_t dup = last;
+        last = t.nodes[dup].prev;
+        triRemove(t, dup);
+    }
+    return last;
+}
+
+// Remove pontos repetidos e colineares entre start e end; devolve um nó que sobrou
+inline uint32_t triFilterPoints(Triangulator &t, uint32_t start, uint32_t end = UINT32_MAX)
+{
+    if (end == UINT32_MAX)
+        end = start;
+    uint32_t p = start;
+    bool again;
+    do {
+        again = false;
+        TriangulationNode &n = t.nodes[p];
+        if (triEquals(n, t.nodes[n.next]) || triCross(t.nodes[n.prev], n, t.nodes[n.next]) == 0.0) {
+            uint32_t prev = n.prev, next = n.next;
+            triRemove(t, p);
+            triSetReflex(t, prev);
+            triSetReflex(t, next);
+            p = end = prev;
+            if (p == t.nodes[p].next)
+                break;
+            again = true;
+        } else {
+            p = n.next;
+        }
+    } while (again || p != end);
+    return end;
+}
+
+// A diagonal a-b sai de a para dentro do polígono
+inline bool triLocallyInside(const Triangulator &t, const TriangulationNode &a, const TriangulationNode &b)
+{
+    const TriangulationNode &prev = t.nodes[a.prev], &next = t.nodes[a.next];
+    return triCross(prev, a, next) > 0.0 ? triCross(a, b, next) <= 0.0 && triCross(a, prev, b) <= 0.0
+                                         : triCross(a, b, prev) > 0.0 || triCross(a, next, b) > 0.0;
+}
+
+// Liga a e b por uma diagonal, duplicando os dois; devolve a cópia de b
+inline uint32_t triSplitPolygon(Triangulator &t, uint32_t a, uint32_t b)
+{
+    uint32_t a2 = uint32_t(t.nodes.size()), b2 = a2 + 1;
+    TriangulationNode na = t.nodes[a], nb = t.nodes[b];
+    na.reflex = nb.reflex = na.listed = nb.listed = false;
+    t.nodes.push_back(na);
+    t.nodes.push_back(nb);
+    uint32_t an = t.nodes[a].next, bp = t.nodes[b].prev;
+    t.nodes[a].next = b;
+    t.nodes[b].prev = a;
+    t.nodes[a2].next = an;
+    t.nodes[an].prev = a2;
+    t.nodes[b2].next = a2;
+    t.nodes[a2].prev = b2;
+    t.nodes[bp].next = b2;
+    t.nodes[b2].prev = bp;
+    return b2;
+}
+
+// Vértice do contorno que enxerga o ponto mais à esquerda do furo (raio para a esquerda)
+inline uint32_t triFindHoleBridge(const Triangulator &t, uint32_t hole, uint32_t outer)
+{
+    const TriangulationNode &h = t.nodes[hole];
+    double hx = h.x, hy = h.y, qx = -INFINITY;
+    uint32_t p = outer, m = UINT32_MAX;
+    if (triEquals(h, t.nodes[p]))
+        return p;
+    do {
+        const TriangulationNode &a = t.nodes[p], &b = t.nodes[a.next];
+        if (triEquals(h, b))
+            return a.next;
+        if (hy <= a.y && hy >= b.y && b.y != a.y) {
+            double x = a.x + (hy - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (x <= hx && x > qx) {
+                qx = x;
+                m = a.x < b.x ? p : a.next;
+                if (x == hx)
+                    return m; // o furo encosta no contorno
+            }
+        }
+        p = a.next;
+    } while (p != outer);
+    if (m == UINT32_MAX)
+        return m;
+
+    // Algum vértice dentro do triângulo (furo, interseção, m)? Fica o de menor ângulo com o raio
+    uint32_t stop = m;
+    double mx = t.nodes[m].x, my = t.nodes[m].y, tanMin = INFINITY;
+    p = m;
+    do {
+        const TriangulationNode &n = t.nodes[p];
+        if (hx >= n.x && n.x >= mx && hx != n.x &&
+            triPointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, n.x, n.y)) {
+            double tan = std::fabs(hy - n.y) / (hx - n.x);
+            const TriangulationNode &best = t.nodes[m];
+            if (triLocallyInside(t, n, h) &&
+                (tan < tanMin ||
+                 (tan == tanMin &&
+                  (n.x > best.x || (n.x == best.x && triCross(t.nodes[best.prev], best, t.nodes[n.prev]) > 0.0 &&
+                                    triCross(t.nodes[n.next], best, t.nodes[best.next]) > 0.0))))) {
+                m = p;
+                tanMin = tan;
+            }
+        }
+        p = n.next;
+    } while (p != stop);
+    return m;
+}
+
+// Grade dos côncavos, com células suficientes para ~1 côncavo por célula
+inline void triBuildGrid(Triangulator &t, uint32_t start)
+{
+    t.reflexNodes.clear();
+    t.lateReflex.clear();
+    t.reflexAlive = 0;
+    double maxX = -INFINITY, maxY = -INFINITY;
+    t.minX = t.minY = INFINITY;
+    uint32_t p = start;
+    do {
+        TriangulationNode &n = t.nodes[p];
+        n.reflex = triCross(t.nodes[n.prev], n, t.nodes[n.next]) <= 0.0;
+        n.listed = n.reflex;
+        if (n.reflex) {
+            t.reflexNodes.push_back({float(n.x), float(n.y), p});
+            t.reflexAlive++;
+        }
+        t.minX = std::min(t.minX, n.x);
+        t.minY = std::min(t.minY, n.y);
+        maxX = std::max(maxX, n.x);
+        maxY = std::max(maxY, n.y);
+        p = n.next;
+    } while (p != start);
+
+    double width = maxX - t.minX, height = maxY - t.minY;
+    double cells = double(std::max<size_t>(1, t.reflexNodes.size()));
+    t.cellSize = width > 0.0 && height > 0.0 ? std::sqrt(width * height / cells)
+                                             : std::max(std::max(width, height) / cells, 1e-30);
+    t.cols = int(std::min(65535.0, width / t.cellSize)) + 1;
+    t.rows = int(std::min(65535.0, height / t.cellSize)) + 1;
+    t.cellSize = std::max(width / t.cols, height / t.rows) * (1.0 + 1e-9);
+    if (t.cellSize <= 0.0)
+        t.cellSize = 1.0;
+
+    size_t cellTotal = size_t(t.cols) * t.rows;
+    t.cellStart.assign(cellTotal + 1, 0);
+    t.cellCount.assign(cellTotal, 0);
+    auto cellOf = [&](const TriangulationPoint &n) {
+        int cx = std::min(t.cols - 1, int((n.x - t.minX) / t.cellSize));
+        int cy = std::min(t.rows - 1, int((n.y - t.minY) / t.cellSize));
+        return size_t(cy) * t.cols + cx;
+    };
+    for (const TriangulationPoint &p : t.reflexNodes)
+        t.cellCount[cellOf(p)]++;
+    for (size_t c = 0; c < cellTotal; ++c)
+        t.cellStart[c + 1] = t.cellStart[c] + t.cellCount[c];
+    t.cellItems.resize(t.reflexNodes.size());
+    std::vector<uint32_t> &fill = t.cellCount; // reaproveitado como cursor e volta a ser a contagem
+    std::fill(fill.begin(), fill.end(), 0);
+    for (const TriangulationPoint &p : t.reflexNodes) {
+        size_t c = cellOf(p);
+        t.cellItems[t.cellStart[c] + fill[c]++] = p;
+    }
+}
+
+// Algum côncavo de 'list' bloqueia a orelha a, b, c? Os que deixaram de ser côncavos saem da
+// lista quando são lidos ('compactAll': todos; senão só os que caem na caixa)
+inline bool triBlocked(Triangulator &t, TriangulationPoint *list, uint32_t &count, uint32_t ia, uint32_t ib,
+                       uint32_t ic, double x0, double y0, double x1, double y1, bool compactAll)
+{
+    const TriangulationNode &a = t.nodes[ia], &b = t.nodes[ib], &c = t.nodes[ic];
+    for (uint32_t k = 0; k < count;) {
+        const TriangulationPoint &q = list[k];
+        bool inBox = q.x >= x0 && q.x <= x1 && q.y >= y0 && q.y <= y1;
+        if (!inBox && !compactAll) {
+            ++k;
+            continue;
+        }
+        uint32_t i = q.node;
+        TriangulationNode &p = t.nodes[i];
+        if (!p.reflex) {
+            list[k] = list[--count]; // deixou de ser côncavo (ou saiu do polígono)
+            p.listed = false;
+            continue;
+        }
+        ++k;
+        if (!inBox || i == ia || i == ib || i == ic)
+            continue;
+        if (!(p.x == a.x && p.y == a.y) && triPointInTriangle(a.x, a.y, b.x, b.y, c.x, c.y, p.x, p.y))
+            return true;
+    }
+    return false;
+}
+
+inline bool triIsEar(Triangulator &t, uint32_t ear)
+{
+    const TriangulationNode &b = t.nodes[ear];
+    const TriangulationNode &a = t.nodes[b.prev], &c = t.nodes[b.next];
+    if (triCross(a, b, c) <= 0.0)
+        return false; // côncavo
+    if (t.reflexAlive == 0)
+        return true;
+    double x0 = std::min({a.x, b.x, c.x}), y0 = std::min({a.y, b.y, c.y});
+    double x1 = std::max({a.x, b.x, c.x}), y1 = std::max({a.y, b.y, c.y});
+    int cx0 = std::max(0, int((x0 - t.minX) / t.cellSize)), cy0 = std::max(0, int((y0 - t.minY) / t.cellSize));
+    int cx1 = std::min(t.cols - 1, int((x1 - t.minX) / t.cellSize));
+    int cy1 = std::min(t.rows - 1, int((y1 - t.minY) / t.cellSize));
+    size_t cells = size_t(cx1 - cx0 + 1) * size_t(cy1 - cy0 + 1);
+    if (!t.useSpatialHash || cells > t.reflexAlive) {
+        uint32_t count = uint32_t(t.reflexNodes.size());
+        bool blocked = triBlocked(t, t.reflexNodes.data(), count, b.prev, ear, b.next, x0, y0, x1, y1, true);
+        t.reflexNodes.resize(count);
+        return !blocked;
+    }
+    // Por linha da grade, só as células que o triângulo atravessa (orelhas finas e inclinadas
+    // têm caixa grande e pouca área)
+    const TriangulationNode *corners[3] = {&a, &b, &c};
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        double rowLo = std::max(y0, t.minY + cy * t.cellSize), rowHi = std::min(y1, t.minY + (cy + 1) * t.cellSize);
+        double spanLo = INFINITY, spanHi = -INFINITY;
+        for (int k = 0; k < 3; ++k) {
+            const TriangulationNode &p = *corners[k], &q = *corners[(k + 1) % 3];
+            if (p.y >= rowLo && p.y <= rowHi) {
+                spanLo = std::min(spanLo, p.x);
+                spanHi = std::max(spanHi, p.x);
+            }
+            for (double y : {rowLo, rowHi})
+                if ((p.y - y) * (q.y - y) < 0.0) {
+                    double x = p.x + (y - p.y) * (q.x - p.x) / (q.y - p.y);
+                    spanLo = std::min(spanLo, x);
+                    spanHi = std::max(spanHi, x);
+                }
+        }
+        if (spanLo > spanHi)
+            continue;
+        int first = std::max(cx0, int((spanLo - t.minX) / t.cellSize));
+        int last = std::min(cx1, int((spanHi - t.minX) / t.cellSize));
+        for (int cx = first; cx <= last; ++cx) {
+            size_t cell = size_t(cy) * t.cols + cx;
+            if (t.cellCount[cell] != 0 && triBlocked(t, &t.cellItems[t.cellStart[cell]], t.cellCount[cell], b.prev,
+                                                     ear, b.next, x0, y0, x1, y1, false))
+                return false;
+        }
+    }
+    uint32_t count = uint32_t(t.lateReflex.size());
+    bool blocked = triBlocked(t, t.lateReflex.data(), count, b.prev, ear, b.next, x0, y0, x1, y1, false);
+    t.lateReflex.resize(count);
+    return !blocked;
+}
+
+// Segmentos p1-q1 e p2-q2 se cruzam (sem contar toques colineares)
+inline bool triIntersects(const TriangulationNode &p1, const TriangulationNode &q1, const TriangulationNode &p2,
+                          const TriangulationNode &q2)
+{
+    auto sign = [](double v) { return v > 0.0 ? 1 : v < 0.0 ? -1 : 0; };
+    int o1 = sign(triCross(p1, q1, p2)), o2 = sign(triCross(p1, q1, q2));
+    int o3 = sign(triCross(p2, q2, p1)), o4 = sign(triCross(p2, q2, q1));
+    return o1 != o2 && o3 != o4 && o1 && o2 && o3 && o4;
+}
+
+// Desfaz laços pequenos (a-p-p.next-b com p-a e p.next-b se cruzando) emitindo um triângulo
+inline uint32_t triCureLocalIntersections(Triangulator &t, uint32_t start, std::vector<uint32_t> &indices)
+{
+    uint32_t p = start;
+    do {
+        uint32_t a = t.nodes[p].prev, pn = t.nodes[p].next, b = t.nodes[pn].next;
+        if (!triEquals(t.nodes[a], t.nodes[b]) && triIntersects(t.nodes[a], t.nodes[p], t.nodes[pn], t.nodes[b]) &&
+            triLocallyInside(t, t.nodes[a], t.nodes[b]) && triLocallyInside(t, t.nodes[b], t.nodes[a])) {
+            indices.insert(indices.end(), {t.nodes[a].index, t.nodes[p].index, t.nodes[b].index});
+            triRemove(t, p);
+            triRemove(t, pn);
+            triSetReflex(t, a);
+            triSetReflex(t, b);
+            p = start = b;
+        }
+        p = t.nodes[p].next;
+    } while (p != start);
+    return triFilterPoints(t, p);
+}
+
+// Comprimento² da diagonal que o recorte de 'i' cria
+inline double triDiagonal(const Triangulator &t, uint32_t i)
+{
+    const TriangulationNode &a = t.nodes[t.nodes[i].prev], &c = t.nodes[t.nodes[i].next];
+    return (c.x - a.x) * (c.x - a.x) + (c.y - a.y) * (c.y - a.y);
+}
+
+inline void triPushEar(Triangulator &t, uint32_t i)
+{
+    double key = triDiagonal(t, i);
+    int exponent = 0;
+    frexp(key / (t.cellSize * t.cellSize), &exponent);
+    int bucket = std::max(0, std::min(TRIANGULATION_BUCKETS - 1, exponent + TRIANGULATION_BUCKETS / 2));
+    t.earBuckets[bucket].push_back({key, i});
+    t.lowestBucket = std::min(t.lowestBucket, bucket);
+}
+
+inline void triFillEars(Triangulator &t, uint32_t from)
+{
+    for (auto &bucket : t.earBuckets)
+        bucket.clear();
+    t.lowestBucket = TRIANGULATION_BUCKETS;
+    uint32_t p = from;
+    do {
+        triPushEar(t, p);
+        p = t.nodes[p].next;
+    } while (p != from);
+}
+
+// Próxima orelha da fila, ou UINT32_MAX
+inline uint32_t triNextEar(Triangulator &t)
+{
+    while (t.lowestBucket < TRIANGULATION_BUCKETS) {
+        std::vector<TriangulationCandidate> &bucket = t.earBuckets[t.lowestBucket];
+        if (bucket.empty()) {
+            t.lowestBucket++;
+            continue;
+        }
+        TriangulationCandidate candidate = bucket.back();
+        bucket.pop_back();
+        // Entrada velha (o vértice saiu ou ganhou vizinhos novos) ou que não é orelha
+        if (!t.nodes[candidate.node].removed && candidate.key == triDiagonal(t, candidate.node) &&
+            triIsEar(t, candidate.node))
+            return candidate.node;
+    }
+    return UINT32_MAX;
+}
+
+// Recorta as orelhas do polígono que passa por 'start'. Um recorte só muda o estado dos dois
+// vizinhos (Eberly), então só eles voltam para a fila, em vez de dar a volta no polígono atrás
+// da próxima orelha (quadrático em espirais e faixas longas). A fila sai pela diagonal mais
+// curta, aproximada por baldes de potência de 2 (um heap de verdade perde para as faltas de
+// cache com 1M de vértices): os triângulos ficam pequenos e cada teste cobre poucas células.
+inline void triClipEars(Triangulator &t, uint32_t start, std::vector<uint32_t> &indices)
+{
+    triFillEars(t, start);
+    uint32_t current = start;
+    int pass = 0;
+    while (t.nodes[current].prev != t.nodes[current].next) {
+        uint32_t ear = triNextEar(t);
+        if (ear == UINT32_MAX) {
+            // Nenhuma orelha: limpa colineares, desfaz cruzamentos e por fim força uma
+            if (pass == 0)
+                current = triFilterPoints(t, current);
+            else if (pass == 1)
+                current = triCureLocalIntersections(t, current, indices);
+            pass = std::min(pass + 1, 2);
+            if (t.nodes[current].prev == t.nodes[current].next)
+                break;
+            if (pass < 2) {
+                triFillEars(t, current);
+                continue;
+            }
+            ear = current;
+        }
+        uint32_t prev = t.nodes[ear].prev, next = t.nodes[ear].next;
+        indices.insert(indices.end(), {t.nodes[prev].index, t.nodes[ear].index, t.nodes[next].index});
+        triRemove(t, ear);
+        triSetReflex(t, prev);
+        triSetReflex(t, next);
+        current = next;
+        triPushEar(t, prev);
+        triPushEar(t, next);
+    }
+}
+
+// Triangula o polígono de 'count' vértices (x, y, z) com furos começando em 'holeStarts'.
+// Escreve em 'indices' (substitui o conteúdo) e devolve false se a entrada não é um polígono.
+inline bool triangulate(Triangulator &t, const float *xyz, size_t count, const std::vector<uint32_t> &holeStarts,
+                        std::vector<uint32_t> &indices)
+{
+    indices.clear();
+    t.nodes.clear();
+    uint32_t outerEnd = holeStarts.empty() ? uint32_t(count) : holeStarts[0];
+    if (count < 3 || count >= UINT32_MAX / 2 || outerEnd < 3 || outerEnd > count) {
+        fprintf(stderr, "triangulação: polígono inválido (%zu vértices)\n", count);
+        return false;
+    }
+    t.nodes.reserve(count + 2 * holeStarts.size());
+    indices.reserve((count + 2 * holeStarts.size()) * 3);
+    uint32_t outer = triLinkRing(t, xyz, 0, outerEnd, true);
+    if (outer == UINT32_MAX || t.nodes[outer].next == t.nodes[outer].prev)
+        return true; // menos de 3 pontos distintos: nada a desenhar
+
+    // Furos: ligados ao contorno do mais à esquerda para o mais à direita
+    std::vector<uint32_t> holes;
+    for (size_t h = 0; h < holeStarts.size(); ++h) {
+        uint32_t begin = holeStarts[h], end = h + 1 < holeStarts.size() ? holeStarts[h + 1] : uint32_t(count);
+        if (begin >= end || end > count) {
+            fprintf(stderr, "triangulação: furo %zu inválido\n", h);
+            return false;
+        }
+        uint32_t last = triLinkRing(t, xyz, begin, end, false);
+        if (last == UINT32_MAX || t.nodes[last].next == t.nodes[last].prev)
+            continue; // menos de 3 pontos distintos
+        uint32_t leftmost = last, p = last;
+        do {
+            const TriangulationNode &n = t.nodes[p], &l = t.nodes[leftmost];
+            if (n.x < l.x || (n.x == l.x && n.y < l.y))
+                leftmost = p;
+            p = n.next;
+        } while (p != last);
+        holes.push_back(leftmost);
+    }
+    std::sort(holes.begin(), holes.end(), [&](uint32_t a, uint32_t b) {
+        const TriangulationNode &na = t.nodes[a], &nb = t.nodes[b];
+        return na.x != nb.x ? na.x < nb.x : na.y < nb.y;
+    });
+    for (uint32_t hole : holes) {
+        uint32_t bridge = triFindHoleBridge(t, hole, outer);
+        if (bridge == UINT32_MAX)
+            continue; // furo fora do contorno: ignorado
+        uint32_t reverse = triSplitPolygon(t, bridge, hole);
+        triFilterPoints(t, reverse, t.nodes[reverse].next);
+        outer = triFilterPoints(t, bridge, t.nodes[bridge].next);
+    }
+
+    triBuildGrid(t, outer);
+    triClipEars(t, outer, indices);
+    return true;
+}
+
+inline bool triangulate(const float *xyz, size_t count, const std::vector<uint32_t> &holeStarts,
+                        std::vector<uint32_t> &indices)
+{
+    Triangulator t;
+    return triangulate(t, xyz, count, holeStarts, indices);
+}
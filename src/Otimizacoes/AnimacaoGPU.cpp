@@ -0,0 +1,362 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+
+// Animação calculada no vertex shader: a boca do Pac-Man e o crescimento da espiral
+// dependem só do índice do vértice (gl_VertexID) e do tempo (uniform), então nenhum
+// vértice é reenviado por frame. Cena 1: N pac-men instanciados com fases independentes;
+// cena 2: espiral crescendo em número de voltas. O caminho de CPU (tecla C) refaz os vértices
+// a cada frame e os reenvia, como seria animar PacMan.cpp e Espiral.cpp; com "--bench N" os dois
+// caminhos das duas cenas rodam o mesmo número de frames e o tempo de cada um é mostrado.
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr int PACMAN_SEGMENTS = 50;
+constexpr float PACMAN_MOUTH_ANGLE = 0.2f * 3.1415926f; // abertura máxima da boca
+constexpr int DEFAULT_PACMEN = 10000;
+constexpr int SPIRAL_POINTS = 2000;
+constexpr float SPIRAL_MAX_TURNS = 8.0f;
+constexpr float SPIRAL_MAX_RADIUS = 0.9f;
+constexpr float PI = 3.1415926f;
+constexpr int BENCH_FRAMES = 100;
+constexpr double BENCH_STEP_S = 1.0 / 60.0; // tempo fixo por frame no bench, mesma animação nos dois caminhos
+
+// Vertex Shader do Pac-Man: vértice 0 é o centro, os demais percorrem o arco fora da boca
+const char *pacmanVertexShaderSource = R"(
+#version 400
+layout (location = 1) in vec4 pacman;   // centro (NDC), raio, fase
+uniform float u_time;
+uniform float u_mouth;                  // abertura máxima (rad)
+uniform int u_segments;
+out vec3 vColor;
+void main() {
+    vec2 p = vec2(0.0);
+    if (gl_VertexID > 0) {
+        float mouth = u_mouth * (0.5 + 0.5 * sin(u_time * 8.0 + pacman.w));
+        float t = float(gl_VertexID - 1) / float(u_segments);
+        float theta = mouth + (2.0 * 3.1415926 - 2.0 * mouth) * t;
+        p = pacman.z * vec2(cos(theta), sin(theta));
+    }
+    gl_Position = vec4(pacman.xy + p, 0.0, 1.0);
+    vColor = vec3(1.0, 1.0, 0.0);
+}
+)";
+
+// Vertex Shader da espiral: o vértice i fica em i / (N - 1) das voltas visíveis
+const char *spiralVertexShaderSource = R"(
+#version 400
+uniform float u_turns;                  // voltas visíveis
+uniform float u_maxTurns;
+uniform float u_maxRadius;
+uniform int u_points;
+out vec3 vColor;
+void main() {
+    float theta = float(gl_VertexID) / float(u_points - 1) * u_turns * 2.0 * 3.1415926;
+    float r = u_maxRadius * theta / (u_maxTurns * 2.0 * 3.1415926);
+    gl_Position = vec4(r * cos(theta), r * sin(theta), 0.0, 1.0);
+    vColor = vec3(1.0, 0.0, 0.0);
+}
+)";
+
+// Vertex Shader do caminho de CPU: os vértices já chegam animados
+const char *cpuVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec2 position;
+uniform vec3 u_color;
+out vec3 vColor;
+void main() {
+    gl_Position = vec4(position, 0.0, 1.0);
+    vColor = u_color;
+}
+)";
+
+const char *fragmentShaderSource = R"(
+#version 400
+in vec3 vColor;
+out vec4 color;
+void main() {
+    color = vec4(vColor, 1.0);
+}
+)";
+
+int scene = 1;
+bool cpuAnimation = false;
+
+// Callback de teclado: ESC fecha, 1 e 2 trocam de cena, C alterna entre CPU e GPU
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_1 && action == GLFW_PRESS)
+        scene = 1;
+    if (key == GLFW_KEY_2 && action == GLFW_PRESS)
+        scene = 2;
+    if (key == GLFW_KEY_C && action == GLFW_PRESS)
+        cpuAnimation = !cpuAnimation;
+}
+
+// Instâncias dos pac-men: centro, raio e fase
+std::vector<float> pacmenInstances(int count)
+{
+    std::mt19937 rng{3};
+    std::uniform_real_distribution<float> pos(-0.98f, 0.98f);
+    std::uniform_real_distribution<float> phase(0.0f, 2.0f * 3.1415926f);
+    // Raio diminui com a quantidade para manter a tela legível
+    float radius = std::max(0.008f, 0.5f / sqrtf(float(count)));
+
+    std::vector<float> instances;
+    instances.reserve(count * 4);
+    for (int i = 0; i < count; ++i)
+        instances.insert(instances.end(), {pos(rng), pos(rng), radius, phase(rng)});
+    return instances;
+}
+
+// Caminho de GPU: as instâncias são enviadas uma única vez
+GLuint setupPacmen(const std::vector<float> &instances, GLuint &instanceVBO)
+{
+    GLuint VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &instanceVBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(float), instances.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return VAO;
+}
+
+// Caminho de CPU: mesma conta do vertex shader, um leque de PACMAN_SEGMENTS + 2 vértices por pac-man
+void animatePacmenCPU(const std::vector<float> &instances, float t, std::vector<float> &vertices)
+{
+    vertices.clear();
+    for (size_t i = 0; i < instances.size(); i += 4) {
+        float x = instances[i], y = instances[i + 1], r = instances[i + 2], phase = instances[i + 3];
+        float mouth = PACMAN_MOUTH_ANGLE * (0.5f + 0.5f * sinf(t * 8.0f + phase));
+        vertices.insert(vertices.end(), {x, y});
+        for (int s = 0; s <= PACMAN_SEGMENTS; ++s) {
+            float theta = mouth + (2.0f * PI - 2.0f * mouth) * float(s) / float(PACMAN_SEGMENTS);
+            vertices.insert(vertices.end(), {x + r * cosf(theta), y + r * sinf(theta)});
+        }
+    }
+}
+
+// Caminho de CPU da espiral: SPIRAL_POINTS pontos nas voltas visíveis
+void animateSpiralCPU(float turns, std::vector<float> &vertices)
+{
+    vertices.clear();
+    for (int i = 0; i < SPIRAL_POINTS; ++i) {
+        float theta = float(i) / float(SPIRAL_POINTS - 1) * turns * 2.0f * PI;
+        float r = SPIRAL_MAX_RADIUS * theta / (SPIRAL_MAX_TURNS * 2.0f * PI);
+        vertices.insert(vertices.end(), {r * cosf(theta), r * sinf(theta)});
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+    const char *countArg = bench ? (argc > 2 ? argv[2] : nullptr) : (argc > 1 ? argv[1] : nullptr);
+    int pacmanCount = countArg ? std::max(1, atoi(countArg)) : DEFAULT_PACMEN;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Animação na GPU", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    GLuint pacmanShader = buildShaderProgram(pacmanVertexShaderSource, fragmentShaderSource);
+    GLint timeLoc = glGetUniformLocation(pacmanShader, "u_time");
+    glUseProgram(pacmanShader);
+    glUniform1f(glGetUniformLocation(pacmanShader, "u_mouth"), PACMAN_MOUTH_ANGLE);
+    glUniform1i(glGetUniformLocation(pacmanShader, "u_segments"), PACMAN_SEGMENTS);
+
+    GLuint spiralShader = buildShaderProgram(spiralVertexShaderSource, fragmentShaderSource);
+    GLint turnsLoc = glGetUniformLocation(spiralShader, "u_turns");
+    glUseProgram(spiralShader);
+    glUniform1f(glGetUniformLocation(spiralShader, "u_maxTurns"), SPIRAL_MAX_TURNS);
+    glUniform1f(glGetUniformLocation(spiralShader, "u_maxRadius"), SPIRAL_MAX_RADIUS);
+    glUniform1i(glGetUniformLocation(spiralShader, "u_points"), SPIRAL_POINTS);
+
+    GLuint cpuShader = buildShaderProgram(cpuVertexShaderSource, fragmentShaderSource);
+    GLint cpuColorLoc = glGetUniformLocation(cpuShader, "u_color");
+
+    std::vector<float> instances = pacmenInstances(pacmanCount);
+    GLuint instanceVBO;
+    GLuint pacmanVAO = setupPacmen(instances, instanceVBO);
+    // A espiral não tem atributos: a posição sai de gl_VertexID (o core profile exige um VAO)
+    GLuint spiralVAO;
+    glGenVertexArrays(1, &spiralVAO);
+
+    // Caminho de CPU: um VBO reenviado por inteiro a cada frame e um leque por pac-man em uma
+    // única glMultiDrawArrays
+    GLsizei fanVertices = PACMAN_SEGMENTS + 2;
+    size_t cpuCapacity = std::max(size_t(pacmanCount) * fanVertices, size_t(SPIRAL_POINTS)) * 2 * sizeof(float);
+    GLuint cpuVAO, cpuVBO;
+    glGenVertexArrays(1, &cpuVAO);
+    glGenBuffers(1, &cpuVBO);
+    glBindVertexArray(cpuVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, cpuVBO);
+    glBufferData(GL_ARRAY_BUFFER, cpuCapacity, nullptr, GL_STREAM_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    std::vector<GLint> fanFirst(pacmanCount);
+    std::vector<GLsizei> fanCount(pacmanCount, fanVertices);
+    for (int i = 0; i < pacmanCount; ++i)
+        fanFirst[i] = i * fanVertices;
+    std::vector<float> cpuVertices;
+    cpuVertices.reserve(cpuCapacity / sizeof(float));
+
+    // Bench: BENCH_FRAMES frames em cada caminho, na ordem pac-men GPU, pac-men CPU,
+    // espiral GPU, espiral CPU, com o tempo avançando BENCH_STEP_S por frame
+    const char *benchNames[4] = {"pac-men GPU", "pac-men CPU", "espiral GPU", "espiral CPU"};
+    double benchFrameMs[4] = {}, benchCpuMs[4] = {};
+    size_t benchBytes[4] = {};
+    int benchFrames[4] = {};
+    int frame = 0;
+
+    double start_s = glfwGetTime();
+    double prev_s = start_s;
+    double title_countdown_s = 0.1;
+    double frameTimeSum = 0.0;
+    int frameCount = 0;
+    size_t uploadBytes = 0;
+
+    while (!glfwWindowShouldClose(window)) {
+        int path = frame / BENCH_FRAMES;
+        if (bench) {
+            if (path == 4)
+                break;
+            scene = path < 2 ? 1 : 2;
+            cpuAnimation = path % 2 == 1;
+        }
+
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        if (frameCount > 0)
+            frameTimeSum += elapsed_s;
+        frameCount++;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Animação na %s (%s) \tFPS %.2lf \tenvios/frame %zu bytes",
+                     cpuAnimation ? "CPU" : "GPU", scene == 1 ? "pac-men" : "espiral", 1.0 / elapsed_s, uploadBytes);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+        double frame_start_s = glfwGetTime();
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        float t = bench ? float(frame * BENCH_STEP_S) : float(curr_s - start_s);
+        float turns = fmodf(t, SPIRAL_MAX_TURNS) + 0.05f;
+        uploadBytes = 0;
+        if (cpuAnimation) {
+            // Vértices refeitos e reenviados a cada frame
+            if (scene == 1)
+                animatePacmenCPU(instances, t, cpuVertices);
+            else
+                animateSpiralCPU(turns, cpuVertices);
+            uploadBytes = cpuVertices.size() * sizeof(float);
+            glUseProgram(cpuShader);
+            glBindVertexArray(cpuVAO);
+            glBindBuffer(GL_ARRAY_BUFFER, cpuVBO);
+            glBufferData(GL_ARRAY_BUFFER, cpuCapacity, nullptr, GL_STREAM_DRAW); // descarta o do frame anterior
+            glBufferSubData(GL_ARRAY_BUFFER, 0, uploadBytes, cpuVertices.data());
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            if (scene == 1) {
+                glUniform3f(cpuColorLoc, 1.0f, 1.0f, 0.0f);
+                glMultiDrawArrays(GL_TRIANGLE_FAN, fanFirst.data(), fanCount.data(), pacmanCount);
+            } else {
+                glUniform3f(cpuColorLoc, 1.0f, 0.0f, 0.0f);
+                glDrawArrays(GL_LINE_STRIP, 0, SPIRAL_POINTS);
+            }
+        } else if (scene == 1) {
+            // Só o tempo muda por frame: N pac-men em uma chamada instanciada
+            glUseProgram(pacmanShader);
+            glUniform1f(timeLoc, t);
+            glBindVertexArray(pacmanVAO);
+            glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, PACMAN_SEGMENTS + 2, pacmanCount);
+        } else {
+            // Voltas visíveis crescem com o tempo e recomeçam ao atingir o máximo
+            glUseProgram(spiralShader);
+            glUniform1f(turnsLoc, turns);
+            glBindVertexArray(spiralVAO);
+            glDrawArrays(GL_LINE_STRIP, 0, SPIRAL_POINTS);
+        }
+        glBindVertexArray(0);
+
+        if (bench) {
+            benchCpuMs[path] += (glfwGetTime() - frame_start_s) * 1000.0;
+            glFinish(); // tempo total do frame, com o trabalho da GPU
+            benchFrameMs[path] += (glfwGetTime() - frame_start_s) * 1000.0;
+            benchBytes[path] += uploadBytes;
+            benchFrames[path]++;
+        }
+        frame++;
+
+        glfwSwapBuffers(window);
+    }
+
+    if (bench) {
+        for (int p = 0; p < 4; ++p) {
+            if (benchFrames[p] == 0)
+                continue;
+            printf("%-12s %6d %s, %d frames: frame %.3f ms, CPU %.3f ms, %zu bytes enviados/frame\n", benchNames[p],
+                   p < 2 ? pacmanCount : SPIRAL_POINTS, p < 2 ? "pac-men" : "pontos", benchFrames[p],
+                   benchFrameMs[p] / benchFrames[p], benchCpuMs[p] / benchFrames[p], benchBytes[p] / benchFrames[p]);
+        }
+    } else if (frameCount > 1) {
+        printf("%d %s: %.3f ms/frame em média, %zu bytes de vértices enviados no último frame\n",
+               scene == 1 ? pacmanCount : SPIRAL_POINTS, scene == 1 ? "pac-men" : "pontos de espiral",
+               1000.0 * frameTimeSum / (frameCount - 1), uploadBytes);
+    }
+
+    glDeleteVertexArrays(1, &pacmanVAO);
+    glDeleteVertexArrays(1, &spiralVAO);
+    glDeleteVertexArrays(1, &cpuVAO);
+    glDeleteBuffers(1, &instanceVBO);
+    glDeleteBuffers(1, &cpuVBO);
+    glDeleteProgram(pacmanShader);
+    glDeleteProgram(spiralShader);
+    glDeleteProgram(cpuShader);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
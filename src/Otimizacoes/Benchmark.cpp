@@ -0,0 +1,435 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "gl_trace.h"
+#include "gl_state.h"
+#include "lod.h"
+#include "polyline.h"
+#include "markers.h"
+#include "sdf_shapes.h"
+#include "draw_list.h"
+#include "frame_arena.h"
+
+// Bateria de benchmarks usada por `make bench`: cada cena desenha com os mesmos helpers de
+// Commun/ que as atividades usam (leques com LOD, quatro viewports pelo cache de estado,
+// polilinhas espessas, marcadores, formas SDF e a lista de desenho indireto), com quantidades
+// crescentes de objetos, em uma janela oculta. Uma mudança em um desses helpers aparece aqui.
+// Para cada execução: tempo de frame (com glFinish) em percentis, chamadas de GL por frame
+// (contadas por Commun/gl_trace.h em um frame de aquecimento) e a memória residente antes da
+// cena e a maior lida depois de cada frame (a diferença é o que a cena ocupa, com o driver).
+// Uso: Benchmark [--saida arquivo.json] [--quadros N] [--cena nome] [--max objetos]
+
+constexpr GLuint WIDTH = 800, HEIGHT = 600;
+constexpr int DEFAULT_FRAMES = 30;
+constexpr int SPIRAL_POINTS = 200;
+constexpr float SPIRAL_LINE_WIDTH = 2.0f;
+const int OBJECT_COUNTS[] = {100, 1000, 10000, 100000};
+
+// Leques posicionados por uniform, como nas atividades (malha do círculo unitário do lod.h)
+const char *vertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+uniform vec3 u_transform;   // deslocamento e escala
+void main() {
+    gl_Position = vec4(position.xy * u_transform.z + u_transform.xy, 0.0, 1.0);
+}
+)";
+
+const char *fragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+struct BenchObject
+{
+    float x, y, scale;
+    float r, g, b;
+};
+
+struct BenchState
+{
+    GLuint shader;
+    GLint transformLoc, colorLoc;
+    std::vector<BenchObject> objects;
+
+    CircleLODMesh circles;
+    std::vector<int> circleBuckets; // faixa de LOD de cada objeto
+    PolylineShader polylineShader;
+    std::vector<Polyline> spirals;
+    MarkerRenderer markers;
+    std::vector<Marker> markerData;
+    SdfRenderer sdf;
+    DrawList list;
+    int listMeshes[3];
+};
+
+BenchState bench;
+
+typedef void (*SceneFunction)(int count);
+
+struct Scene
+{
+    const char *name;
+    int maxCount; // cenas mais caras param antes
+    SceneFunction setup, draw, teardown;
+};
+
+void randomObjects(int count, float scale)
+{
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<float> pos(-0.95f, 0.95f), unit(0.2f, 1.0f);
+    bench.objects.clear();
+    for (int i = 0; i < count; ++i)
+        bench.objects.push_back({pos(rng), pos(rng), scale * unit(rng), unit(rng), unit(rng), unit(rng)});
+}
+
+float objectScale(int count) { return std::clamp(1.0f / sqrtf(float(count)), 0.004f, 0.1f); }
+
+// Raio na tela, em pixels, de um objeto de escala 'scale' em NDC (o maior dos dois eixos)
+float objectRadiusPx(float scale) { return scale * 0.5f * float(std::max(WIDTH, HEIGHT)); }
+
+// Leques (Octagono, PacMan, Ex01...): círculo do lod.h com a faixa escolhida pelo raio na
+// tela, uma chamada por objeto
+void setupFans(int count)
+{
+    randomObjects(count, objectScale(count));
+    bench.circles = createCircleLODMesh();
+    bench.circleBuckets.clear();
+    for (const BenchObject &o : bench.objects)
+        bench.circleBuckets.push_back(lodBucket(lodSegmentsForRadius(objectRadiusPx(o.scale))));
+}
+
+void drawFans(int)
+{
+    glUseProgram(bench.shader);
+    glBindVertexArray(bench.circles.VAO);
+    for (size_t i = 0; i < bench.objects.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        int b = bench.circleBuckets[i];
+        glUniform3f(bench.transformLoc, o.x, o.y, o.scale);
+        glUniform4f(bench.colorLoc, o.r, o.g, o.b, 1.0f);
+        glDrawArrays(GL_TRIANGLE_FAN, bench.circles.first[b], bench.circles.count[b]);
+    }
+    glBindVertexArray(0);
+}
+
+void deleteFans(int) { deleteCircleLODMesh(bench.circles); }
+
+// Quatro viewports (ViewportCom4Quadrante): cada leque troca de viewport; programa, VAO e
+// viewport passam pelo cache de estado do gl_state.h, como na atividade
+void setupQuadrants(int count)
+{
+    setupFans(count);
+    stateInvalidate(); // os helpers das outras cenas mexeram no GL direto
+}
+
+void drawQuadrants(int)
+{
+    for (size_t i = 0; i < bench.objects.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        int quadrant = int(i % 4), b = bench.circleBuckets[i];
+        stateViewport((quadrant % 2) * WIDTH / 2, (quadrant / 2) * HEIGHT / 2, WIDTH / 2, HEIGHT / 2);
+        stateUseProgram(bench.shader);
+        stateBindVertexArray(bench.circles.VAO);
+        glUniform3f(bench.transformLoc, o.x, o.y, o.scale);
+        glUniform4f(bench.colorLoc, o.r, o.g, o.b, 1.0f);
+        glDrawArrays(GL_TRIANGLE_FAN, bench.circles.first[b], bench.circles.count[b]);
+    }
+    stateViewport(0, 0, WIDTH, HEIGHT);
+    stateBindVertexArray(0);
+    stateEndFrame();
+}
+
+void deleteQuadrants(int count)
+{
+    deleteFans(count);
+    stateInvalidate();
+}
+
+// Espirais (Espiral): uma polilinha espessa do polyline.h por objeto, montada com o
+// polylineAppend e desenhada em uma chamada instanciada
+void setupSpirals(int count)
+{
+    randomObjects(count, objectScale(count));
+    bench.polylineShader = createPolylineShader();
+    bench.spirals.clear();
+    std::vector<float> points(SPIRAL_POINTS * 3);
+    for (const BenchObject &o : bench.objects) {
+        for (int i = 0; i < SPIRAL_POINTS; ++i) {
+            float t = float(i) / (SPIRAL_POINTS - 1);
+            float angle = t * 6.0f * 3.1415926f;
+            points[i * 3 + 0] = o.x + o.scale * t * cosf(angle);
+            points[i * 3 + 1] = o.y + o.scale * t * sinf(angle);
+            points[i * 3 + 2] = 0.0f;
+        }
+        bench.spirals.push_back(createPolyline());
+        polylineAppend(bench.spirals.back(), points.data(), SPIRAL_POINTS);
+    }
+}
+
+void drawSpirals(int)
+{
+    for (size_t i = 0; i < bench.spirals.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        polylineDraw(bench.polylineShader, bench.spirals[i], SPIRAL_LINE_WIDTH, POLYLINE_ROUND, o.r, o.g, o.b, 1.0f,
+                     float(WIDTH), float(HEIGHT));
+    }
+}
+
+void deleteSpirals(int)
+{
+    for (Polyline &line : bench.spirals)
+        deletePolyline(line);
+    bench.spirals.clear();
+    deletePolylineShader(bench.polylineShader);
+}
+
+// Marcadores (TrianguloComClique, ApenasComPontos): markers.h, reenviados a cada frame como
+// os vértices em construção do TrianguloComClique, em uma chamada GL_POINTS
+void setupMarkers(int count)
+{
+    randomObjects(count, objectScale(count));
+    bench.markers = createMarkerRenderer();
+    bench.markerData.clear();
+    for (size_t i = 0; i < bench.objects.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        bench.markerData.push_back(makeMarker(o.x, o.y, std::max(2.0f, objectRadiusPx(o.scale)), MarkerShape(i % 3),
+                                              o.r, o.g, o.b));
+    }
+}
+
+void drawMarkers(int)
+{
+    markerUpload(bench.markers, bench.markerData);
+    markerDraw(bench.markers);
+}
+
+void deleteMarkers(int) { deleteMarkerRenderer(bench.markers); }
+
+// Formas SDF (FormasSDF): círculos, setores e estrelas do sdf_shapes.h em um quad instanciado
+void setupSdfShapes(int count)
+{
+    randomObjects(count, objectScale(count));
+    bench.sdf = createSdfRenderer();
+    std::vector<SdfShape> shapes;
+    for (size_t i = 0; i < bench.objects.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        float x = (o.x * 0.5f + 0.5f) * WIDTH, y = (o.y * 0.5f + 0.5f) * HEIGHT, radius = objectRadiusPx(o.scale);
+        if (i % 3 == 0)
+            shapes.push_back(sdfCircle(x, y, radius, o.r, o.g, o.b));
+        else if (i % 3 == 1)
+            shapes.push_back(sdfSector(x, y, radius, 0.25f * 3.1415926f, 1.75f * 3.1415926f, o.r, o.g, o.b));
+        else
+            shapes.push_back(sdfStar(x, y, radius, 5, 0.5f, 0.5f * 3.1415926f, o.r, o.g, o.b));
+    }
+    sdfUpload(bench.sdf, shapes);
+}
+
+void drawSdfShapes(int) { sdfDraw(bench.sdf, float(WIDTH), float(HEIGHT)); }
+
+void deleteSdfShapes(int) { deleteSdfRenderer(bench.sdf); }
+
+// Lista indireta (DesenhoIndireto): leques, triângulos e strips do draw_list.h, com os
+// comandos do frame na arena (frame_arena.h)
+void setupDrawList(int count)
+{
+    randomObjects(count, objectScale(count));
+    bench.list = createDrawList((GLADloadproc)glfwGetProcAddress);
+    std::vector<float> fan = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i <= 32; ++i) {
+        float angle = 2.0f * 3.1415926f * i / 32;
+        fan.insert(fan.end(), {cosf(angle), sinf(angle), 0.0f});
+    }
+    const float triangle[] = {-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    const float strip[] = {-1.0f, -0.3f, 0.0f, -1.0f, 0.3f, 0.0f, 0.0f, -0.3f, 0.0f,
+                           0.0f, 0.3f, 0.0f, 1.0f, -0.3f, 0.0f, 1.0f, 0.3f, 0.0f};
+    bench.listMeshes[0] = drawListAddMesh(bench.list, GL_TRIANGLE_FAN, fan.data(), fan.size() / 3);
+    bench.listMeshes[1] = drawListAddMesh(bench.list, GL_TRIANGLES, triangle, 3);
+    bench.listMeshes[2] = drawListAddMesh(bench.list, GL_TRIANGLE_STRIP, strip, 6);
+    drawListUploadMeshes(bench.list);
+}
+
+void drawDrawList(int)
+{
+    frameArenaReset(); // libera os comandos do frame anterior
+    drawListBegin(bench.list);
+    for (size_t i = 0; i < bench.objects.size(); ++i) {
+        const BenchObject &o = bench.objects[i];
+        drawListAdd(bench.list, bench.listMeshes[i % 3], makeDrawParams(o.x, o.y, o.scale, 0.0f, o.r, o.g, o.b));
+    }
+    drawListSubmit(bench.list);
+}
+
+void deleteDrawListScene(int) { deleteDrawList(bench.list); }
+
+const Scene SCENES[] = {
+    {"leques_lod", 100000, setupFans, drawFans, deleteFans},
+    {"viewport_4_quadrantes", 100000, setupQuadrants, drawQuadrants, deleteQuadrants},
+    {"espirais", 10000, setupSpirals, drawSpirals, deleteSpirals},
+    {"marcadores", 100000, setupMarkers, drawMarkers, deleteMarkers},
+    {"formas_sdf", 100000, setupSdfShapes, drawSdfShapes, deleteSdfShapes},
+    {"lista_indireta", 100000, setupDrawList, drawDrawList, deleteDrawListScene},
+};
+
+// Memória residente agora. O pico (ru_maxrss) é o do processo inteiro: depois da maior cena
+// todas as seguintes mostrariam o mesmo valor.
+long currentResidentKb()
+{
+#ifdef __APPLE__
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS)
+        return 0;
+    return long(info.resident_size / 1024);
+#else
+    long pages = 0, resident = 0;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (!statm)
+        return 0;
+    if (fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+}
+
+float percentile(const std::vector<float> &sorted, float p)
+{
+    return sorted[std::min(sorted.size() - 1, size_t(p * sorted.size()))];
+}
+
+int main(int argc, char **argv)
+{
+    const char *outputPath = nullptr;
+    const char *onlyScene = nullptr;
+    int frames = DEFAULT_FRAMES, maxObjects = 1 << 30;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--saida") == 0)
+            outputPath = argv[i + 1];
+        else if (strcmp(argv[i], "--quadros") == 0)
+            frames = std::max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--cena") == 0)
+            onlyScene = argv[i + 1];
+        else if (strcmp(argv[i], "--max") == 0)
+            maxObjects = atoi(argv[i + 1]);
+    }
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Benchmark", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(0);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+    glViewport(0, 0, WIDTH, HEIGHT);
+
+    bench.shader = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
+    bench.transformLoc = glGetUniformLocation(bench.shader, "u_transform");
+    bench.colorLoc = glGetUniformLocation(bench.shader, "inputColor");
+
+    FILE *out = outputPath ? fopen(outputPath, "w") : stdout;
+    if (!out) {
+        std::cerr << "Não foi possível criar " << outputPath << std::endl;
+        return -1;
+    }
+    fprintf(out, "{\n  \"renderer\": \"%s\",\n  \"quadros\": %d,\n  \"resultados\": [",
+            (const char *)glGetString(GL_RENDERER), frames);
+
+    bool first = true;
+    for (const Scene &scene : SCENES) {
+        if (onlyScene && strcmp(onlyScene, scene.name) != 0)
+            continue;
+        for (int count : OBJECT_COUNTS) {
+            if (count > scene.maxCount || count > maxObjects)
+                continue;
+            long residentBefore = currentResidentKb();
+            scene.setup(count);
+            long residentPeak = currentResidentKb();
+
+            // Frame de aquecimento com os wrappers do gl_trace contando as chamadas
+            glTraceInstall();
+            glClear(GL_COLOR_BUFFER_BIT);
+            scene.draw(count);
+            glTraceEndFrame();
+            glTraceRemove();
+            glFinish();
+            glfwSwapBuffers(window);
+
+            std::vector<float> frameMs;
+            for (int f = 0; f < frames; ++f) {
+                double start = glfwGetTime();
+                glClear(GL_COLOR_BUFFER_BIT);
+                scene.draw(count);
+                glFinish();
+                frameMs.push_back(float(1000.0 * (glfwGetTime() - start)));
+                glfwSwapBuffers(window);
+                glfwPollEvents();
+                residentPeak = std::max(residentPeak, currentResidentKb());
+            }
+
+            std::vector<float> sorted = frameMs;
+            std::sort(sorted.begin(), sorted.end());
+            double total = 0.0;
+            for (float ms : sorted)
+                total += ms;
+            fprintf(out,
+                    "%s\n    {\"cena\": \"%s\", \"objetos\": %d, \"media_ms\": %.3f, \"p50_ms\": %.3f, "
+                    "\"p95_ms\": %.3f, \"p99_ms\": %.3f, \"chamadas_gl\": %llu, \"rss_antes_kb\": %ld, "
+                    "\"rss_pico_kb\": %ld, \"rss_cena_kb\": %ld}",
+                    first ? "" : ",", scene.name, count, total / frames, percentile(sorted, 0.50f),
+                    percentile(sorted, 0.95f), percentile(sorted, 0.99f), (unsigned long long)glTrace.lastFrameCalls,
+                    residentBefore, residentPeak, residentPeak - residentBefore);
+            fflush(out);
+            first = false;
+            fprintf(stderr, "%-24s %7d objetos: p50 %8.3f ms, %llu chamadas de GL\n", scene.name, count,
+                    percentile(sorted, 0.50f), (unsigned long long)glTrace.lastFrameCalls);
+
+            // Apaga os objetos da cena antes da próxima leitura da memória
+            scene.teardown(count);
+            glFinish();
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+    if (outputPath)
+        fclose(out);
+
+    glDeleteProgram(bench.shader);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,243 @@
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "job_system.h"
+#include "mesh_loader.h"
+
+// Tempo até o primeiro frame com uma cena enorme (50M de vértices por padrão): espirais longas,
+// como a do Espiral, em pedaços de 1M de vértices.
+//   padrão       cada pedaço é gerado em um job (job_system.h) e enviado à GPU pela thread de
+//                carga com contexto compartilhado (mesh_loader.h); a janela desenha desde o
+//                primeiro frame o que já estiver pronto
+//   --sincrono   como nas atividades: tudo gerado e enviado antes do primeiro frame
+// Ao sair mostra o tempo até o primeiro frame, até tudo carregar e o maior frame durante a
+// carga. Uso: CargaAssincrona [--vertices N] [--pedaco N] [--sincrono] [--sair]
+// (--sair fecha a janela no primeiro frame com a cena completa)
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr float PI = 3.1415926f;
+constexpr float SPIRAL_TURNS = 60.0f;
+constexpr float SPIRAL_MAX_RADIUS = 0.2f;
+
+// Vertex Shader: posição 2D, deslocada pelo centro da espiral
+const char *vertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec2 position;
+void main() {
+    gl_Position = vec4(position, 0.0, 1.0);
+}
+)";
+
+// Fragment Shader: cor por pedaço
+const char *fragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+using Clock = std::chrono::steady_clock;
+const Clock::time_point programStart = Clock::now();
+
+double elapsedMs()
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - programStart).count();
+}
+
+// Centro do pedaço numa grade que cobre a janela
+void chunkCenter(int id, int chunks, float &cx, float &cy)
+{
+    int side = std::max(1, int(ceilf(sqrtf(float(chunks)))));
+    float cell = 2.0f / float(side);
+    cx = -1.0f + cell * (float(id % side) + 0.5f);
+    cy = -1.0f + cell * (float(id / side) + 0.5f);
+}
+
+// Espiral de Arquimedes com 'count' vértices (LINE_STRIP), centrada no pedaço
+MeshChunk *buildSpiralChunk(int id, int chunks, GLsizei count)
+{
+    MeshChunk *chunk = new MeshChunk;
+    chunk->id = id;
+    chunk->vertices.resize(size_t(count) * 2);
+    float cx, cy;
+    chunkCenter(id, chunks, cx, cy);
+    float scale = std::min(SPIRAL_MAX_RADIUS, 0.9f / float(std::max(1, int(ceilf(sqrtf(float(chunks)))))));
+    float thetaStep = SPIRAL_TURNS * 2.0f * PI / float(count);
+    float b = scale / (SPIRAL_TURNS * 2.0f * PI);
+    for (GLsizei i = 0; i < count; ++i) {
+        float theta = float(i) * thetaStep;
+        float r = b * theta;
+        chunk->vertices[size_t(i) * 2 + 0] = cx + r * cosf(theta);
+        chunk->vertices[size_t(i) * 2 + 1] = cy + r * sinf(theta);
+    }
+    return chunk;
+}
+
+void chunkColor(int id, float rgb[3])
+{
+    uint32_t h = uint32_t(id) * 2654435761u;
+    rgb[0] = 0.3f + 0.7f * float(h & 0xFF) / 255.0f;
+    rgb[1] = 0.3f + 0.7f * float((h >> 8) & 0xFF) / 255.0f;
+    rgb[2] = 0.3f + 0.7f * float((h >> 16) & 0xFF) / 255.0f;
+}
+
+int main(int argc, char **argv)
+{
+    long long totalVertices = 50000000;
+    GLsizei chunkVertices = 1000000;
+    bool synchronous = false, exitWhenLoaded = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--vertices") == 0 && i + 1 < argc)
+            totalVertices = std::max(1LL, atoll(argv[++i]));
+        else if (strcmp(argv[i], "--pedaco") == 0 && i + 1 < argc)
+            chunkVertices = std::max(2, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--sincrono") == 0)
+            synchronous = true;
+        else if (strcmp(argv[i], "--sair") == 0)
+            exitWhenLoaded = true;
+    }
+    int chunks = int((totalVertices + chunkVertices - 1) / chunkVertices);
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Carga em segundo plano", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    GLuint shaderID = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
+    GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
+
+    std::vector<MeshChunk *> ready;
+    MeshLoader loader;
+    JobSystem jobs;
+    JobCounter built;
+    std::atomic<bool> cancel{false};
+
+    auto chunkSize = [&](int id) {
+        return GLsizei(std::min<long long>(chunkVertices, totalVertices - (long long)id * chunkVertices));
+    };
+
+    if (synchronous) {
+        // Caminho antigo: a thread principal gera e envia tudo antes do primeiro frame
+        for (int id = 0; id < chunks; ++id) {
+            MeshChunk *chunk = buildSpiralChunk(id, chunks, chunkSize(id));
+            meshLoaderUpload(chunk);
+            meshLoaderSetupVAO(chunk);
+            ready.push_back(chunk);
+        }
+    } else {
+        if (!meshLoaderStart(loader, window))
+            std::cout << "sem contexto compartilhado: envio pela thread principal" << std::endl;
+        // A thread principal não executa jobs (só espera no fim), então o pool tem pelo menos
+        // uma thread além dela
+        jobSystemStart(jobs, std::max(2, int(std::thread::hardware_concurrency())));
+        for (int id = 0; id < chunks; ++id)
+            jobSubmit(jobs, [&, id] {
+                if (!cancel.load(std::memory_order_relaxed))
+                    meshLoaderSubmit(loader, buildSpiralChunk(id, chunks, chunkSize(id)));
+            }, &built);
+    }
+
+    double firstFrameMs = 0.0, loadedMs = 0.0, worstFrameMs = 0.0;
+    int firstFrameChunks = -1;
+    double prevMs = elapsedMs();
+    double title_countdown_s = 0.1;
+
+    glUseProgram(shaderID);
+    while (!glfwWindowShouldClose(window)) {
+        glfwPollEvents();
+        if (!synchronous)
+            meshLoaderPoll(loader, ready);
+
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (MeshChunk *chunk : ready) {
+            float rgb[3];
+            chunkColor(chunk->id, rgb);
+            glUniform4f(colorLoc, rgb[0], rgb[1], rgb[2], 1.0f);
+            glBindVertexArray(chunk->VAO);
+            glDrawArrays(GL_LINE_STRIP, 0, chunk->count);
+        }
+        glBindVertexArray(0);
+        glfwSwapBuffers(window);
+
+        double nowMs = elapsedMs();
+        bool complete = int(ready.size()) == chunks;
+        if (firstFrameChunks < 0) {
+            firstFrameMs = nowMs;
+            firstFrameChunks = int(ready.size());
+        } else if (loadedMs == 0.0) {
+            worstFrameMs = std::max(worstFrameMs, nowMs - prevMs);
+        }
+        if (complete && loadedMs == 0.0) {
+            loadedMs = nowMs;
+            if (exitWhenLoaded)
+                glfwSetWindowShouldClose(window, GL_TRUE);
+        }
+
+        title_countdown_s -= (nowMs - prevMs) / 1000.0;
+        if (title_countdown_s <= 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Carga em segundo plano \tpedaços %d/%d \tframe %.1lf ms", int(ready.size()), chunks,
+                     nowMs - prevMs);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+        prevMs = nowMs;
+    }
+
+    printf("%s: %lld vértices em %d pedaços\n", synchronous ? "síncrono" : "segundo plano", totalVertices, chunks);
+    printf("primeiro frame:   %8.1f ms (%d de %d pedaços)\n", firstFrameMs, firstFrameChunks, chunks);
+    if (loadedMs > 0.0)
+        printf("tudo carregado:   %8.1f ms\n", loadedMs);
+    if (!synchronous)
+        printf("maior frame durante a carga: %.1f ms\n", worstFrameMs);
+
+    if (!synchronous) {
+        cancel = true;
+        jobWait(jobs, built);
+        jobSystemStop(jobs);
+        meshLoaderStop(loader);
+    }
+    for (MeshChunk *chunk : ready)
+        deleteMeshChunk(chunk);
+    glDeleteProgram(shaderID);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "lod.h"
+
+// Milhares de círculos de tamanhos variados: compara o leque fixo de 100 segmentos
+// (CIRCLE_SEGMENTS das atividades) com o LOD escolhido pelo raio na tela.
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr int FIXED_SEGMENTS = 100;
+constexpr int DEFAULT_CIRCLES = 5000;
+
+// Vertex Shader: círculo unitário escalado e posicionado por instância (em pixels)
+const char *vertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 circle;   // centro (x, y) e raio, em pixels
+layout (location = 2) in vec3 instColor;
+uniform vec2 u_viewport;
+out vec3 vColor;
+void main() {
+    vec2 p = circle.xy + position.xy * circle.z;
+    gl_Position = vec4(p / u_viewport * 2.0 - 1.0, 0.0, 1.0);
+    vColor = instColor;
+}
+)";
+
+// Fragment Shader
+const char *fragmentShaderSource = R"(
+#version 400
+in vec3 vColor;
+out vec4 color;
+void main() {
+    color = vec4(vColor, 1.0);
+}
+)";
+
+struct CircleInstance
+{
+    float x, y, radius;
+    float r, g, b;
+};
+
+bool useLOD = true;
+
+// Callback de teclado: ESC fecha, L alterna entre LOD e leque fixo
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_L && action == GLFW_PRESS)
+        useLOD = !useLOD;
+}
+
+// Sorteia círculos com raio log-uniforme entre 1 e 200 pixels, ordenados por faixa de LOD
+std::vector<CircleInstance> generateCircles(int count)
+{
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> pos(0.0f, float(WIDTH));
+    std::uniform_real_distribution<float> logRadius(0.0f, logf(200.0f));
+    std::uniform_real_distribution<float> col(0.2f, 1.0f);
+
+    std::vector<CircleInstance> circles(count);
+    for (auto &c : circles)
+        c = {pos(rng), pos(rng), expf(logRadius(rng)), col(rng), col(rng), col(rng)};
+
+    std::sort(circles.begin(), circles.end(), [](const CircleInstance &a, const CircleInstance &b) {
+        return a.radius < b.radius;
+    });
+    return circles;
+}
+
+// Aponta os atributos de instância do VAO atual para 'firstInstance' dentro do buffer
+void setInstanceAttributes(GLuint instanceVBO, int firstInstance)
+{
+    GLsizei stride = sizeof(CircleInstance);
+    size_t offset = size_t(firstInstance) * stride;
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *)offset);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid *)(offset + 3 * sizeof(float)));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void enableInstanceAttributes(GLuint VAO, GLuint instanceVBO)
+{
+    glBindVertexArray(VAO);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribDivisor(2, 1);
+    setInstanceAttributes(instanceVBO, 0);
+    glBindVertexArray(0);
+}
+
+// Leque fixo de FIXED_SEGMENTS segmentos (caminho antigo)
+GLuint setupFixedCircle()
+{
+    std::vector<float> vertices = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i <= FIXED_SEGMENTS; ++i) {
+        float theta = 2.0f * LOD_PI * float(i) / float(FIXED_SEGMENTS);
+        vertices.insert(vertices.end(), {cosf(theta), sinf(theta), 0.0f});
+    }
+
+    GLuint VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glDeleteBuffers(1, &VBO); // VAO mantém referência
+    return VAO;
+}
+
+int main(int argc, char **argv)
+{
+    int circleCount = argc > 1 ? std::max(1, atoi(argv[1])) : DEFAULT_CIRCLES;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Círculos com LOD", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    GLuint shaderID = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
+    GLint viewportLoc = glGetUniformLocation(shaderID, "u_viewport");
+
+    // Instâncias ordenadas pelo raio: cada faixa de LOD ocupa um trecho contínuo do buffer
+    std::vector<CircleInstance> circles = generateCircles(circleCount);
+    int bucketFirst[LOD_BUCKETS] = {}, bucketInstances[LOD_BUCKETS] = {};
+    for (int i = 0; i < circleCount; ++i) {
+        int b = lodBucket(lodSegmentsForRadius(circles[i].radius));
+        if (bucketInstances[b]++ == 0)
+            bucketFirst[b] = i;
+    }
+
+    GLuint instanceVBO;
+    glGenBuffers(1, &instanceVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, circles.size() * sizeof(CircleInstance), circles.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    CircleLODMesh lodMesh = createCircleLODMesh();
+    GLuint fixedVAO = setupFixedCircle();
+    enableInstanceAttributes(lodMesh.VAO, instanceVBO);
+    enableInstanceAttributes(fixedVAO, instanceVBO);
+
+    // Vértices submetidos por frame em cada modo
+    long long fixedVertices = (long long)circleCount * (FIXED_SEGMENTS + 2);
+    long long lodVertices = 0;
+    for (int b = 0; b < LOD_BUCKETS; ++b)
+        lodVertices += (long long)bucketInstances[b] * lodMesh.count[b];
+    std::cout << circleCount << " círculos - vértices por frame: fixo = " << fixedVertices
+              << ", LOD = " << lodVertices << " (" << double(fixedVertices) / double(lodVertices) << "x menos)" << std::endl;
+
+    glUseProgram(shaderID);
+    glUniform2f(viewportLoc, float(WIDTH), float(HEIGHT));
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Círculos com %s \tFPS %.2lf \tvértices/frame %lld",
+                     useLOD ? "LOD" : "100 segmentos", 1.0 / elapsed_s, useLOD ? lodVertices : fixedVertices);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (useLOD) {
+            // Uma chamada instanciada por faixa de LOD
+            glBindVertexArray(lodMesh.VAO);
+            for (int b = 0; b < LOD_BUCKETS; ++b) {
+                if (bucketInstances[b] == 0)
+                    continue;
+                setInstanceAttributes(instanceVBO, bucketFirst[b]);
+                glDrawArraysInstanced(GL_TRIANGLE_FAN, lodMesh.first[b], lodMesh.count[b], bucketInstances[b]);
+            }
+        } else {
+            glBindVertexArray(fixedVAO);
+            glDrawArraysInstanced(GL_TRIANGLE_FAN, 0, FIXED_SEGMENTS + 2, circleCount);
+        }
+        glBindVertexArray(0);
+
+        glfwSwapBuffers(window);
+    }
+
+    deleteCircleLODMesh(lodMesh);
+    glDeleteVertexArrays(1, &fixedVAO);
+    glDeleteBuffers(1, &instanceVBO);
+    glDeleteProgram(shaderID);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "draw_list.h"
+
+// Cena com formas de modos diferentes (leques do Octagono/PacMan/Estrela, a casa indexada
+// do DesenhoCuston e um anel em strip) girando. Caminho direto: uniforms + uma chamada
+// por forma. Caminho indireto: Commun/draw_list.h, um comando por forma em um buffer
+// indireto e uma chamada multi-draw por modo (ou laço de glDrawElementsIndirect no 4.0).
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr int DEFAULT_DRAWS = 50000;
+constexpr int BENCH_FRAMES = 50;
+
+// Caminho direto: transformação e cor por uniform, como nas atividades
+const char *directVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+uniform vec4 u_transform;   // deslocamento, escala, rotação
+void main() {
+    float c = cos(u_transform.w), s = sin(u_transform.w);
+    vec2 p = position.xy * u_transform.z;
+    gl_Position = vec4(vec2(c * p.x - s * p.y, s * p.x + c * p.y) + u_transform.xy, 0.0, 1.0);
+}
+)";
+
+const char *directFragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+bool useIndirect = true;
+
+// Callback de teclado: ESC fecha, I alterna entre o caminho direto e o indireto
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_I && action == GLFW_PRESS)
+        useIndirect = !useIndirect;
+}
+
+// Leque com centro na origem: 'segments' fatias entre os ângulos start e end (raio alternado para estrela)
+std::vector<float> fanVertices(int segments, float start, float end, float innerRadius = 1.0f)
+{
+    std::vector<float> v = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i <= segments; ++i) {
+        float angle = start + (end - start) * i / segments;
+        float radius = i % 2 == 1 ? innerRadius : 1.0f;
+        v.insert(v.end(), {radius * cosf(angle), radius * sinf(angle), 0.0f});
+    }
+    return v;
+}
+
+// Anel como triangle strip alternando raio externo e interno
+std::vector<float> ringVertices(int segments, float innerRadius)
+{
+    std::vector<float> v;
+    for (int i = 0; i <= segments; ++i) {
+        float angle = 2.0f * 3.1415926f * i / segments;
+        v.insert(v.end(), {cosf(angle), sinf(angle), 0.0f});
+        v.insert(v.end(), {innerRadius * cosf(angle), innerRadius * sinf(angle), 0.0f});
+    }
+    return v;
+}
+
+struct SceneShape
+{
+    int mesh;
+    DrawParams params;
+    float spin;
+};
+
+int main(int argc, char **argv)
+{
+    bool bench = false, forceLoop = false;
+    int drawCount = DEFAULT_DRAWS;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--bench") == 0)
+            bench = true;
+        else if (strcmp(argv[i], "--sem-mdi") == 0)
+            forceLoop = true;
+        else
+            drawCount = std::max(1, atoi(argv[i]));
+    }
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Desenho indireto", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    DrawList list = createDrawList((GLADloadproc)glfwGetProcAddress);
+    if (forceLoop)
+        list.useMultiDraw = false;
+    std::cout << (list.useMultiDraw ? "glMultiDrawElementsIndirect disponível"
+                                    : "Sem multi-draw: laço de glDrawElementsIndirect") << std::endl;
+
+    // Malhas das atividades, centradas na origem com raio 1
+    std::vector<float> octagon = fanVertices(8, 0.0f, 2.0f * 3.1415926f);
+    std::vector<float> pacman = fanVertices(50, 0.2f * 3.1415926f, 1.8f * 3.1415926f);
+    std::vector<float> star = fanVertices(10, 0.5f * 3.1415926f, 2.5f * 3.1415926f, 0.4f);
+    std::vector<float> ring = ringVertices(24, 0.6f);
+    const float house[] = {
+        0.0f, 1.0f, 0.0f, -1.0f, 0.3f, 0.0f, 1.0f, 0.3f, 0.0f,              // telhado
+        -0.8f, 0.3f, 0.0f, 0.8f, 0.3f, 0.0f, 0.8f, -1.0f, 0.0f, -0.8f, -1.0f, 0.0f // corpo
+    };
+    const GLuint houseIndices[] = {0, 1, 2, 3, 4, 5, 3, 5, 6};
+    int meshes[] = {
+        drawListAddMesh(list, GL_TRIANGLE_FAN, octagon.data(), octagon.size() / 3),
+        drawListAddMesh(list, GL_TRIANGLE_FAN, pacman.data(), pacman.size() / 3),
+        drawListAddMesh(list, GL_TRIANGLE_FAN, star.data(), star.size() / 3),
+        drawListAddMesh(list, GL_TRIANGLE_STRIP, ring.data(), ring.size() / 3),
+        drawListAddMesh(list, GL_TRIANGLES, house, 7, houseIndices, 9),
+    };
+    drawListUploadMeshes(list);
+
+    // Formas espalhadas com tamanho, cor e velocidade de giro aleatórios
+    std::mt19937 rng{21};
+    std::uniform_real_distribution<float> pos(-0.97f, 0.97f), unit(0.0f, 1.0f);
+    std::uniform_int_distribution<int> pick(0, 4);
+    float size = std::clamp(0.8f / sqrtf(float(drawCount)), 0.004f, 0.15f);
+    std::vector<SceneShape> shapes;
+    for (int i = 0; i < drawCount; ++i)
+        shapes.push_back({meshes[pick(rng)],
+                          makeDrawParams(pos(rng), pos(rng), size * (0.5f + unit(rng)), 6.28f * unit(rng),
+                                         0.3f + 0.7f * unit(rng), 0.3f + 0.7f * unit(rng), 0.3f + 0.7f * unit(rng)),
+                          unit(rng) * 2.0f - 1.0f});
+
+    GLuint directShader = buildShaderProgram(directVertexShaderSource, directFragmentShaderSource);
+    GLint transformLoc = glGetUniformLocation(directShader, "u_transform");
+    GLint colorLoc = glGetUniformLocation(directShader, "inputColor");
+
+    double start_s = glfwGetTime();
+    double prev_s = start_s;
+    double title_countdown_s = 0.1;
+    int frame = 0;
+    double submitTime[2] = {0.0, 0.0}, frameTime[2] = {0.0, 0.0};
+    int submitCalls = 0;
+    uint64_t warmupHeapAllocations = 0;
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Desenho indireto (%s, %d formas, %d chamadas) \tFPS %.2lf",
+                     useIndirect ? "indireto" : "direto", drawCount, submitCalls, 1.0 / elapsed_s);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+        frameArenaReset(); // libera os comandos do frame anterior (draw_list.h)
+        if (frame == BENCH_FRAMES + 2) // dois frames do caminho indireto para aquecer a arena
+            warmupHeapAllocations = frameArenaHeapAllocations();
+
+        // Benchmark: primeiro o caminho direto, depois o indireto
+        if (bench)
+            useIndirect = frame >= BENCH_FRAMES;
+
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        float t = float(curr_s - start_s);
+        double frameStart = glfwGetTime();
+        if (useIndirect) {
+            drawListBegin(list);
+            for (const SceneShape &s : shapes) {
+                DrawParams p = s.params;
+                p.rotation += s.spin * t;
+                drawListAdd(list, s.mesh, p);
+            }
+            drawListSubmit(list);
+            submitCalls = list.submitCalls;
+        } else {
+            glUseProgram(directShader);
+            glBindVertexArray(list.VAO);
+            for (const SceneShape &s : shapes) {
+                const DrawMesh &mesh = list.meshes[s.mesh];
+                glUniform4f(transformLoc, s.params.offsetX, s.params.offsetY, s.params.scale,
+                            s.params.rotation + s.spin * t);
+                glUniform4f(colorLoc, s.params.r, s.params.g, s.params.b, s.params.a);
+                glDrawElementsBaseVertex(mesh.mode, mesh.count, GL_UNSIGNED_INT,
+                                         (GLvoid *)(mesh.firstIndex * sizeof(GLuint)), mesh.baseVertex);
+            }
+            glBindVertexArray(0);
+            submitCalls = drawCount;
+        }
+        double submitEnd = glfwGetTime();
+
+        if (bench) {
+            glFinish();
+            submitTime[useIndirect] += submitEnd - frameStart;
+            frameTime[useIndirect] += glfwGetTime() - frameStart;
+            if (++frame == 2 * BENCH_FRAMES) {
+                printf("%d formas, CPU de envio (ms/frame): direto %.3f, indireto %.3f (%s)\n", drawCount,
+                       1000.0 * submitTime[0] / BENCH_FRAMES, 1000.0 * submitTime[1] / BENCH_FRAMES,
+                       list.useMultiDraw ? "multi-draw" : "laço");
+                printf("frame completo com glFinish (ms/frame): direto %.3f, indireto %.3f\n",
+                       1000.0 * frameTime[0] / BENCH_FRAMES, 1000.0 * frameTime[1] / BENCH_FRAMES);
+                printf("arena do frame: %.1f KB no último frame, %llu alocações no heap depois do aquecimento\n",
+                       frameArena.lastFrameBytes / 1024.0,
+                       (unsigned long long)(frameArenaHeapAllocations() - warmupHeapAllocations));
+                glfwSetWindowShouldClose(window, GL_TRUE);
+            }
+        }
+
+        glfwSwapBuffers(window);
+    }
+
+    deleteDrawList(list);
+    glDeleteProgram(directShader);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,309 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "sdf_shapes.h"
+
+// Círculos, setores e estrelas desenhados por SDF em um quad instanciado.
+// Sem argumentos mostra as formas das atividades (Ex01, FatiaPizza, PacMan, Estrela);
+// com "--bench N" compara N formas no caminho de leques (TRIANGLE_FAN) com o caminho SDF.
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr float PI = 3.1415926f;
+constexpr int BENCH_FRAMES = 100;
+constexpr int TIME_QUERIES = 4; // frames em voo antes de ler o tempo de GPU
+
+// Parâmetros das atividades
+constexpr int CIRCLE_SEGMENTS = 100;
+constexpr int PACMAN_SEGMENTS = 50;
+constexpr float PACMAN_MOUTH_ANGLE = 0.2f * PI;
+constexpr int STAR_POINTS = 5;
+constexpr float STAR_INNER_RATIO = 0.22f / 0.5f;
+
+// Vertex Shader do caminho de leques: malha unitária transformada por instância
+const char *fanVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec4 shape;     // centro (px), raio (px), rotação
+layout (location = 3) in vec4 instColor;
+uniform vec2 u_viewport;
+out vec4 vColor;
+void main() {
+    float c = cos(shape.w), s = sin(shape.w);
+    vec2 p = shape.xy + shape.z * vec2(c * position.x - s * position.y, s * position.x + c * position.y);
+    gl_Position = vec4(p / u_viewport * 2.0 - 1.0, 0.0, 1.0);
+    vColor = instColor;
+}
+)";
+
+const char *fanFragmentShaderSource = R"(
+#version 400
+in vec4 vColor;
+out vec4 color;
+void main() {
+    color = vColor;
+}
+)";
+
+bool useSDF = true;
+
+// Callback de teclado: ESC fecha, S alterna entre SDF e leques
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_S && action == GLFW_PRESS)
+        useSDF = !useSDF;
+}
+
+// Malhas unitárias (TRIANGLE_FAN) equivalentes às das atividades, todas em um VBO
+struct FanMeshes
+{
+    GLuint VAO = 0, VBO = 0;
+    GLint first[3];
+    GLsizei count[3];
+};
+
+FanMeshes setupFanMeshes(GLuint instanceVBO)
+{
+    FanMeshes fans;
+    std::vector<float> v;
+    auto addFan = [&](int kind, int segments, float start, float end, bool star) {
+        fans.first[kind] = GLint(v.size() / 3);
+        v.insert(v.end(), {0.0f, 0.0f, 0.0f});
+        for (int i = 0; i <= segments; ++i) {
+            float theta = start + (end - start) * float(i) / float(segments);
+            float r = (star && i % 2 == 1) ? STAR_INNER_RATIO : 1.0f;
+            v.insert(v.end(), {r * cosf(theta), r * sinf(theta), 0.0f});
+        }
+        fans.count[kind] = segments + 2;
+    };
+    addFan(SDF_CIRCLE, CIRCLE_SEGMENTS, 0.0f, 2.0f * PI, false);
+    // Setor do Pac-Man centrado em 0 rad, como o setor SDF (rotation = direção do centro)
+    addFan(SDF_SECTOR, PACMAN_SEGMENTS, PACMAN_MOUTH_ANGLE - PI, PI - PACMAN_MOUTH_ANGLE, false);
+    addFan(SDF_STAR, STAR_POINTS * 2, 0.0f, 2.0f * PI, true);
+
+    glGenVertexArrays(1, &fans.VAO);
+    glGenBuffers(1, &fans.VBO);
+    glBindVertexArray(fans.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, fans.VBO);
+    glBufferData(GL_ARRAY_BUFFER, v.size() * sizeof(float), v.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+
+    // Mesmas instâncias do caminho SDF (atributos 1 e 3)
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SdfShape), (GLvoid *)0);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SdfShape), (GLvoid *)(8 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribDivisor(3, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return fans;
+}
+
+// Formas das atividades, uma por quadrante
+std::vector<SdfShape> galleryScene()
+{
+    float r = 150.0f;
+    return {
+        sdfCircle(200.0f, 600.0f, r, 0.2f, 0.8f, 1.0f),                                   // Ex01
+        sdfSector(600.0f, 600.0f - r / 2, 1.3f * r, 0.0f, PI / 3.0f, 0.2f, 0.8f, 1.0f),   // FatiaPizza
+        sdfSector(200.0f, 200.0f, r, PACMAN_MOUTH_ANGLE, 2.0f * PI - PACMAN_MOUTH_ANGLE,  // PacMan
+                  1.0f, 1.0f, 0.0f),
+        sdfStar(600.0f, 200.0f, r, STAR_POINTS, r * STAR_INNER_RATIO, -0.5f * PI,           // Estrela
+                0.2f, 0.8f, 1.0f),
+    };
+}
+
+// N formas de 2 a 100 px com os mesmos parâmetros das malhas de leque, ordenadas por tipo
+std::vector<SdfShape> benchScene(int count)
+{
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<float> pos(0.0f, float(WIDTH));
+    std::uniform_real_distribution<float> size(2.0f, 100.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 2.0f * PI);
+    std::uniform_real_distribution<float> col(0.2f, 1.0f);
+
+    std::vector<SdfShape> shapes;
+    shapes.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        float x = pos(rng), y = pos(rng), r = size(rng), rot = angle(rng);
+        SdfShape s;
+        switch (i % 3) {
+        case SDF_CIRCLE: s = sdfCircle(x, y, r, col(rng), col(rng), col(rng)); break;
+        case SDF_SECTOR: s = sdfSector(x, y, r, rot + PACMAN_MOUTH_ANGLE, rot + 2.0f * PI - PACMAN_MOUTH_ANGLE,
+                                       col(rng), col(rng), col(rng)); break;
+        default: s = sdfStar(x, y, r, STAR_POINTS, r * STAR_INNER_RATIO, rot, col(rng), col(rng), col(rng)); break;
+        }
+        shapes.push_back(s);
+    }
+    std::stable_sort(shapes.begin(), shapes.end(), [](const SdfShape &a, const SdfShape &b) { return a.kind < b.kind; });
+    return shapes;
+}
+
+int main(int argc, char **argv)
+{
+    bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+    int shapeCount = bench ? (argc > 2 ? std::max(1, atoi(argv[2])) : 100000) : 0;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Formas SDF", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    std::vector<SdfShape> shapes = bench ? benchScene(shapeCount) : galleryScene();
+    SdfRenderer sdf = createSdfRenderer();
+    sdfUpload(sdf, shapes);
+
+    GLuint fanProgram = buildShaderProgram(fanVertexShaderSource, fanFragmentShaderSource);
+    GLint fanViewportLoc = glGetUniformLocation(fanProgram, "u_viewport");
+    FanMeshes fans = setupFanMeshes(sdf.instanceVBO);
+
+    // Instâncias de cada tipo são contíguas (ordenadas por tipo)
+    int kindFirst[3] = {}, kindCount[3] = {};
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        int k = int(shapes[i].kind);
+        if (kindCount[k]++ == 0)
+            kindFirst[k] = int(i);
+    }
+    long long fanVertices = 0;
+    for (int k = 0; k < 3; ++k)
+        fanVertices += (long long)kindCount[k] * fans.count[k];
+    long long sdfVertices = (long long)shapes.size() * 4;
+
+    // Tempo de GPU por frame (GL_TIME_ELAPSED) acumulado por modo. As queries rodam em anel e
+    // cada uma só é lida TIME_QUERIES frames depois, quando já está pronta: ler no mesmo frame
+    // esperaria a GPU terminar e entraria na medida.
+    double gpuMs[2] = {0.0, 0.0}, cpuMs[2] = {0.0, 0.0}, frameMs[2] = {0.0, 0.0};
+    GLuint timeQueries[TIME_QUERIES];
+    int queryMode[TIME_QUERIES];
+    glGenQueries(TIME_QUERIES, timeQueries);
+    auto collectQuery = [&](int slot) {
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(timeQueries[slot], GL_QUERY_RESULT, &ns);
+        gpuMs[queryMode[slot]] += double(ns) / 1.0e6;
+    };
+    int frames[2] = {0, 0};
+    int frame = 0;
+    if (bench)
+        useSDF = false; // primeiro os leques, depois SDF
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Formas %s \tFPS %.2lf \tvértices/frame %lld", useSDF ? "SDF" : "leque",
+                     1.0 / elapsed_s, useSDF ? sdfVertices : fanVertices);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+        if (bench) {
+            if (frame == 2 * BENCH_FRAMES)
+                break; // BENCH_FRAMES em cada modo, nenhum frame a mais no último
+            useSDF = frame >= BENCH_FRAMES;
+        }
+
+        int slot = frame % TIME_QUERIES;
+        if (frame >= TIME_QUERIES)
+            collectQuery(slot);
+        queryMode[slot] = useSDF;
+
+        double cpu_start = glfwGetTime();
+        glBeginQuery(GL_TIME_ELAPSED, timeQueries[slot]);
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        if (useSDF) {
+            sdfDraw(sdf, float(WIDTH), float(HEIGHT));
+        } else {
+            glUseProgram(fanProgram);
+            glUniform2f(fanViewportLoc, float(WIDTH), float(HEIGHT));
+            glBindVertexArray(fans.VAO);
+            for (int k = 0; k < 3; ++k) {
+                if (kindCount[k] == 0)
+                    continue;
+                // Reaponta os atributos de instância para o trecho deste tipo
+                glBindBuffer(GL_ARRAY_BUFFER, sdf.instanceVBO);
+                size_t offset = size_t(kindFirst[k]) * sizeof(SdfShape);
+                glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(SdfShape), (GLvoid *)offset);
+                glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SdfShape), (GLvoid *)(offset + 8 * sizeof(float)));
+                glDrawArraysInstanced(GL_TRIANGLE_FAN, fans.first[k], fans.count[k], kindCount[k]);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindVertexArray(0);
+        }
+        glEndQuery(GL_TIME_ELAPSED);
+        cpuMs[useSDF] += (glfwGetTime() - cpu_start) * 1000.0;
+        if (bench)
+            glFinish(); // tempo total do frame, válido mesmo em drivers sem timer confiável
+        frameMs[useSDF] += (glfwGetTime() - cpu_start) * 1000.0;
+
+        frames[useSDF]++;
+        frame++;
+
+        glfwSwapBuffers(window);
+    }
+
+    for (int i = std::max(0, frame - TIME_QUERIES); i < frame; ++i) // as que ainda não foram lidas
+        collectQuery(i % TIME_QUERIES);
+
+    const char *names[2] = {"leque", "SDF"};
+    for (int m = 0; m < 2 && bench; ++m) {
+        if (frames[m] == 0)
+            continue;
+        printf("%-6s %7zu formas, %d frames: frame %.3f ms, GPU %.3f ms, CPU %.3f ms, %lld vértices/frame\n",
+               names[m], shapes.size(), frames[m], frameMs[m] / frames[m], gpuMs[m] / frames[m], cpuMs[m] / frames[m],
+               m ? sdfVertices : fanVertices);
+    }
+
+    glDeleteQueries(TIME_QUERIES, timeQueries);
+    glDeleteVertexArrays(1, &fans.VAO);
+    glDeleteBuffers(1, &fans.VBO);
+    glDeleteProgram(fanProgram);
+    deleteSdfRenderer(sdf);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
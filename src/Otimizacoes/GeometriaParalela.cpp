@@ -0,0 +1,269 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "job_system.h"
+#include "frame_arena.h"
+
+// Geração de geometria em paralelo com o job_system.h, para cenas com milhões de formas.
+// Três etapas encadeadas por dependências (sem barreira na thread principal entre elas):
+//   1. dados de instância: posição, escala, cor e a matriz de transformação de cada forma
+//      (a mesma translação que o Exec3 monta com glm::translate, aqui com escala);
+//   2. descarte: formas cujo círculo envolvente não toca o viewport [-1, 1] saem; cada bloco
+//      conta as suas visíveis e um job pequeno soma os prefixos (onde cada bloco escreve);
+//   3. vértices: leques de octógono, estrela, PacMan e triângulo, como nas atividades, gerados
+//      a partir de tabelas do círculo unitário e transformados pela matriz da instância.
+// Cada configuração de threads é comparada com a versão em série (mesmo resultado, bit a bit).
+// Cada construção é tratada como um frame: instâncias, saída do descarte e vértices ficam na
+// arena do frame (frame_arena.h), zerada antes de cada repetição.
+// Uso: GeometriaParalela [--formas N] [--threads N] [--grao N]
+
+constexpr float PI = 3.1415926f;
+constexpr int FAN_VERTICES = 12; // centro + 11 vértices de borda, para todas as formas
+constexpr int SHAPE_KINDS = 4;
+
+enum ShapeKind
+{
+    SHAPE_OCTAGON,
+    SHAPE_STAR,
+    SHAPE_PACMAN,
+    SHAPE_TRIANGLE
+};
+
+struct Instance
+{
+    float transform[16]; // coluna principal, como no glm
+    float color[3];
+    float radius;
+    int kind;
+};
+
+// Tudo na arena do frame: vale até o próximo frameArenaReset
+struct Scene
+{
+    size_t count = 0;
+    size_t grain = 16384;
+    Instance *instances = nullptr;       // preenchidas inteiras, então não precisam ser zeradas
+    FrameVector<uint32_t> visible;       // índices visíveis, agrupados por bloco
+    FrameVector<size_t> blockVisible;    // visíveis por bloco
+    FrameVector<size_t> blockOffset;     // primeira posição de cada bloco na saída
+    float *vertices = nullptr;           // xy, FAN_VERTICES por forma visível (espaço para todas)
+    size_t visibleCount = 0;
+};
+
+// Tabela do leque unitário de cada tipo de forma (x, y por vértice)
+float fanTable[SHAPE_KINDS][FAN_VERTICES][2];
+
+void buildFanTables()
+{
+    for (int k = 0; k < SHAPE_KINDS; ++k) {
+        fanTable[k][0][0] = fanTable[k][0][1] = 0.0f;
+        for (int i = 1; i < FAN_VERTICES; ++i) {
+            float t = float(i - 1) / float(FAN_VERTICES - 2); // 0..1 ao longo da borda
+            float angle = 2.0f * PI * t, radius = 1.0f;
+            if (k == SHAPE_OCTAGON) {
+                angle = 2.0f * PI * float((i - 1) % 9) / 8.0f;
+            } else if (k == SHAPE_STAR) {
+                angle = 2.0f * PI * float(i - 1) / 10.0f - PI / 2.0f;
+                radius = (i - 1) % 2 == 0 ? 1.0f : 0.45f;
+            } else if (k == SHAPE_PACMAN) {
+                angle = 0.5f + (2.0f * PI - 1.0f) * t; // boca de ~57 graus
+            } else {
+                angle = 2.0f * PI * float(std::min(i - 1, 3)) / 3.0f + PI / 2.0f;
+            }
+            fanTable[k][i][0] = radius * cosf(angle);
+            fanTable[k][i][1] = radius * sinf(angle);
+        }
+    }
+}
+
+// Número pseudoaleatório a partir do índice: cada forma sai igual em qualquer ordem de execução
+inline uint32_t hashIndex(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+inline float unitFloat(uint32_t h) { return float(h >> 8) * (1.0f / 16777216.0f); }
+
+// Etapa 1: instâncias [first, last)
+void fillInstances(Scene &scene, size_t first, size_t last)
+{
+    for (size_t i = first; i < last; ++i) {
+        uint32_t h = hashIndex(uint32_t(i) * 4u);
+        float x = unitFloat(h) * 3.0f - 1.5f;
+        float y = unitFloat(hashIndex(uint32_t(i) * 4u + 1)) * 3.0f - 1.5f;
+        float scale = 0.002f + 0.018f * unitFloat(hashIndex(uint32_t(i) * 4u + 2));
+        uint32_t c = hashIndex(uint32_t(i) * 4u + 3);
+
+        Instance &inst = scene.instances[i];
+        // translate(mat4(1), (x, y, 0)) * scale(mat4(1), (s, s, 1))
+        float *m = inst.transform;
+        std::fill(m, m + 16, 0.0f);
+        m[0] = scale, m[5] = scale, m[10] = 1.0f, m[15] = 1.0f;
+        m[12] = x, m[13] = y;
+        inst.color[0] = 0.2f + 0.8f * float(c & 0xFF) / 255.0f;
+        inst.color[1] = 0.2f + 0.8f * float((c >> 8) & 0xFF) / 255.0f;
+        inst.color[2] = 0.2f + 0.8f * float((c >> 16) & 0xFF) / 255.0f;
+        inst.radius = scale;
+        inst.kind = int(c >> 30);
+    }
+}
+
+// Etapa 2: descarte do bloco 'block' (os visíveis ficam no início da faixa do bloco)
+void cullBlock(Scene &scene, size_t block)
+{
+    size_t first = block * scene.grain, last = std::min(scene.count, first + scene.grain);
+    size_t out = first;
+    for (size_t i = first; i < last; ++i) {
+        const Instance &inst = scene.instances[i];
+        float x = inst.transform[12], y = inst.transform[13], r = inst.radius;
+        if (x + r >= -1.0f && x - r <= 1.0f && y + r >= -1.0f && y - r <= 1.0f)
+            scene.visible[out++] = uint32_t(i);
+    }
+    scene.blockVisible[block] = out - first;
+}
+
+void prefixSum(Scene &scene)
+{
+    size_t total = 0;
+    for (size_t b = 0; b < scene.blockVisible.size(); ++b) {
+        scene.blockOffset[b] = total;
+        total += scene.blockVisible[b];
+    }
+    scene.visibleCount = total;
+}
+
+// Etapa 3: vértices das formas visíveis do bloco, já na posição final da saída
+void generateBlock(Scene &scene, size_t block)
+{
+    size_t first = block * scene.grain;
+    float *out = scene.vertices + scene.blockOffset[block] * FAN_VERTICES * 2;
+    for (size_t k = 0; k < scene.blockVisible[block]; ++k) {
+        const Instance &inst = scene.instances[scene.visible[first + k]];
+        const float *m = inst.transform;
+        const float(*fan)[2] = fanTable[inst.kind];
+        for (int v = 0; v < FAN_VERTICES; ++v) {
+            *out++ = m[0] * fan[v][0] + m[4] * fan[v][1] + m[12];
+            *out++ = m[1] * fan[v][0] + m[5] * fan[v][1] + m[13];
+        }
+    }
+}
+
+// Começo de um frame: zera a arena da thread principal e aloca nela os dados da cena (os jobs
+// só escrevem, não alocam)
+void prepareScene(Scene &scene, size_t count, size_t grain)
+{
+    frameArenaReset();
+    size_t blocks = (count + grain - 1) / grain;
+    scene.count = count;
+    scene.grain = grain;
+    scene.instances = frameArenaNew<Instance>(count);
+    scene.visible = FrameVector<uint32_t>(count);
+    scene.blockVisible = FrameVector<size_t>(blocks, 0);
+    scene.blockOffset = FrameVector<size_t>(blocks, 0);
+    scene.vertices = frameArenaNew<float>(count * FAN_VERTICES * 2);
+    scene.visibleCount = 0;
+}
+
+// Como seria na thread principal: as três etapas em sequência
+void buildSerial(Scene &scene)
+{
+    fillInstances(scene, 0, scene.count);
+    for (size_t b = 0; b < scene.blockVisible.size(); ++b)
+        cullBlock(scene, b);
+    prefixSum(scene);
+    for (size_t b = 0; b < scene.blockVisible.size(); ++b)
+        generateBlock(scene, b);
+}
+
+// Grafo de jobs: instâncias -> descarte por bloco -> prefixos -> vértices por bloco
+void buildJobs(JobSystem &jobs, Scene &scene)
+{
+    size_t blocks = scene.blockVisible.size();
+    JobCounter filled, culled, summed, generated;
+    for (size_t b = 0; b < blocks; ++b) {
+        size_t first = b * scene.grain, last = std::min(scene.count, first + scene.grain);
+        jobSubmit(jobs, [&scene, first, last] { fillInstances(scene, first, last); }, &filled);
+    }
+    for (size_t b = 0; b < blocks; ++b)
+        jobSubmit(jobs, [&scene, b] { cullBlock(scene, b); }, &culled, {&filled});
+    jobSubmit(jobs, [&scene] { prefixSum(scene); }, &summed, {&culled});
+    for (size_t b = 0; b < blocks; ++b)
+        jobSubmit(jobs, [&scene, b] { generateBlock(scene, b); }, &generated, {&summed});
+    jobWait(jobs, generated);
+}
+
+double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = 1000000, grain = 16384;
+    int maxThreads = std::max(1, int(std::thread::hardware_concurrency()));
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--formas") == 0)
+            count = size_t(atoll(argv[i + 1]));
+        else if (strcmp(argv[i], "--threads") == 0)
+            maxThreads = std::max(1, atoi(argv[i + 1]));
+        else if (strcmp(argv[i], "--grao") == 0)
+            grain = size_t(std::max(1, atoi(argv[i + 1])));
+    }
+    buildFanTables();
+    const int REPEATS = 4;
+    const int WARMUP = 2; // o 1º frame cresce a arena e o 2º junta os blocos em um só
+
+    // Referência em série (os vértices são copiados para fora da arena para comparar depois)
+    Scene reference;
+    double serial = 1e30;
+    uint64_t heapBefore = 0;
+    for (int r = 0; r < REPEATS; ++r) {
+        prepareScene(reference, count, grain);
+        if (r == WARMUP)
+            heapBefore = frameArenaHeapAllocations();
+        auto start = std::chrono::steady_clock::now();
+        buildSerial(reference);
+        serial = std::min(serial, seconds(start));
+    }
+    std::vector<float> referenceVertices(reference.vertices,
+                                         reference.vertices + reference.visibleCount * FAN_VERTICES * 2);
+    printf("%zu formas, %zu visíveis (%zu vértices), blocos de %zu\n", count, reference.visibleCount,
+           reference.visibleCount * FAN_VERTICES, grain);
+    printf("arena do frame: %.1f MB, %llu alocações no heap nos frames depois do aquecimento\n",
+           frameArena.lastFrameBytes / 1048576.0, (unsigned long long)(frameArenaHeapAllocations() - heapBefore));
+    printf("série:      %8.2f ms\n", serial * 1e3);
+
+    // 1, 2, 4... threads, e por último todas
+    for (int n = 1; n <= maxThreads; n = n < maxThreads && n * 2 > maxThreads ? maxThreads : n * 2) {
+        JobSystem jobs;
+        jobSystemStart(jobs, n);
+        Scene scene;
+        double best = 1e30;
+        for (int r = 0; r < REPEATS; ++r) {
+            prepareScene(scene, count, grain);
+            auto start = std::chrono::steady_clock::now();
+            buildJobs(jobs, scene);
+            best = std::min(best, seconds(start));
+        }
+        long long steals = jobs.steals.load();
+        jobSystemStop(jobs);
+
+        bool same = scene.visibleCount == reference.visibleCount &&
+                    memcmp(scene.vertices, referenceVertices.data(), referenceVertices.size() * sizeof(float)) == 0;
+        printf("%2d threads: %8.2f ms  %5.2fx a série  %lld roubos  %s\n", n, best * 1e3, serial / best, steals,
+               same ? "igual à série" : "DIFERENTE da série");
+        if (!same)
+            return 1;
+    }
+    return 0;
+}
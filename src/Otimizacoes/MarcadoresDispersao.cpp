@@ -0,0 +1,186 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "markers.h"
+
+// Gráfico de dispersão com marcadores heterogêneos (tamanho, cor e forma por ponto) pelo
+// Commun/markers.h, em uma única chamada. A comparação é o caminho das atividades:
+// glPointSize + uniform de cor por marcador, uma chamada GL_POINTS para cada um.
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr int DEFAULT_POINTS = 1000000;
+constexpr int BENCH_FRAMES = 10;
+
+// Caminho com estado global, como em ApenasComPontos (ponto quadrado, sem forma)
+const char *pointVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec4 marker;
+void main() {
+    gl_Position = vec4(marker.xy, 0.0, 1.0);
+}
+)";
+
+const char *pointFragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+bool perMarkerDraws = false;
+
+// Callback de teclado: ESC fecha, M alterna entre uma chamada e uma chamada por marcador
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_M && action == GLFW_PRESS)
+        perMarkerDraws = !perMarkerDraws;
+}
+
+// Aglomerados gaussianos; cada aglomerado tem cor e forma próprias e tamanhos variados
+std::vector<Marker> scatterPoints(int count)
+{
+    const float palette[6][3] = {{1.0f, 0.4f, 0.3f}, {0.3f, 0.8f, 1.0f}, {1.0f, 0.85f, 0.2f},
+                                 {0.5f, 1.0f, 0.5f}, {0.9f, 0.5f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+    std::mt19937 rng{5};
+    std::uniform_int_distribution<int> cluster(0, 5);
+    std::uniform_real_distribution<float> size(2.0f, 10.0f);
+    std::normal_distribution<float> spread(0.0f, 0.12f);
+    std::vector<Marker> markers;
+    markers.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        int c = cluster(rng);
+        float cx = -0.5f + 0.5f * (c % 3), cy = c < 3 ? 0.4f : -0.4f;
+        markers.push_back(makeMarker(std::clamp(cx + spread(rng), -1.0f, 1.0f), std::clamp(cy + spread(rng), -1.0f, 1.0f),
+                                     size(rng), MarkerShape(c % 3), palette[c][0], palette[c][1], palette[c][2]));
+    }
+    return markers;
+}
+
+// Uma chamada por marcador, trocando glPointSize e a cor a cada ponto
+void drawPerMarker(const std::vector<Marker> &markers, GLuint program, GLint colorLoc, GLuint VAO)
+{
+    glUseProgram(program);
+    glBindVertexArray(VAO);
+    for (size_t i = 0; i < markers.size(); ++i) {
+        glPointSize(markers[i].size);
+        glUniform4f(colorLoc, markers[i].r, markers[i].g, markers[i].b, markers[i].a);
+        glDrawArrays(GL_POINTS, GLint(i), 1);
+    }
+    glBindVertexArray(0);
+}
+
+int main(int argc, char **argv)
+{
+    bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+    int argIndex = bench ? 2 : 1;
+    int pointCount = argc > argIndex ? std::max(1, atoi(argv[argIndex])) : DEFAULT_POINTS;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Marcadores de dispersão", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    std::vector<Marker> points = scatterPoints(pointCount);
+    MarkerRenderer markers = createMarkerRenderer();
+    markerUpload(markers, points);
+
+    // O caminho por marcador lê o mesmo VBO, só a posição
+    GLuint pointShader = buildShaderProgram(pointVertexShaderSource, pointFragmentShaderSource);
+    GLint colorLoc = glGetUniformLocation(pointShader, "inputColor");
+    GLuint pointVAO;
+    glGenVertexArrays(1, &pointVAO);
+    glBindVertexArray(pointVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, markers.VBO);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(Marker), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+    int frame = 0;
+    double modeTime[2] = {0.0, 0.0};
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Marcadores de dispersão (%d, %s) \tFPS %.2lf", pointCount,
+                     perMarkerDraws ? "uma chamada por marcador" : "uma chamada", 1.0 / elapsed_s);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+
+        // Benchmark: primeiro uma chamada, depois uma chamada por marcador
+        if (bench)
+            perMarkerDraws = frame >= BENCH_FRAMES;
+        double frameStart = glfwGetTime();
+
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (perMarkerDraws)
+            drawPerMarker(points, pointShader, colorLoc, pointVAO);
+        else
+            markerDraw(markers);
+
+        if (bench) {
+            glFinish();
+            modeTime[perMarkerDraws] += glfwGetTime() - frameStart;
+            if (++frame == 2 * BENCH_FRAMES) {
+                printf("%d marcadores: uma chamada = %.3f ms/frame, uma chamada por marcador = %.3f ms/frame\n",
+                       pointCount, 1000.0 * modeTime[0] / BENCH_FRAMES, 1000.0 * modeTime[1] / BENCH_FRAMES);
+                glfwSetWindowShouldClose(window, GL_TRUE);
+            }
+        }
+
+        glfwSwapBuffers(window);
+    }
+
+    deleteMarkerRenderer(markers);
+    glDeleteVertexArrays(1, &pointVAO);
+    glDeleteProgram(pointShader);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
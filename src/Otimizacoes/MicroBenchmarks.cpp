@@ -0,0 +1,609 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "spiral.h"
+
+// Microbenchmarks dos laços de CPU que geram geometria nas atividades: vértices de círculo
+// (setupGeometry do Octagono, setupCircleVAO), arco do generatePacmanVertices, laço da estrela,
+// espiral e segmentos do drawDashedLine. Cada kernel tem variantes (escalar como nas
+// atividades, recorrência de rotação, tabela e SIMD de 4 posições) medidas em vários tamanhos.
+//
+// No estilo do Google Benchmark: cada caso repete o kernel até passar do tempo mínimo e
+// informa ns por execução, vértices por segundo e bytes escritos por segundo. Antes de medir,
+// cada variante é comparada à escalar (erro máximo).
+// Uso: MicroBenchmarks [--filtro texto] [--min-tempo segundos]
+
+// ---------------------------------------------------------------------------------------------
+// Mini-harness
+
+struct MicroState
+{
+    int size;
+    long iterations;
+    double items = 0.0; // vértices (ou segmentos) gerados por execução
+    double bytes = 0.0; // bytes escritos por execução
+};
+
+typedef void (*MicroFunction)(MicroState &);
+
+struct MicroBenchmark
+{
+    std::string name;
+    MicroFunction function;
+};
+
+std::vector<MicroBenchmark> &microRegistry()
+{
+    static std::vector<MicroBenchmark> registry;
+    return registry;
+}
+
+bool registerMicro(const char *name, MicroFunction function)
+{
+    microRegistry().push_back({name, function});
+    return true;
+}
+
+#define MICRO_BENCHMARK(function) static bool function##Registered = registerMicro(#function, function)
+
+// Impede que o compilador descarte o resultado do kernel
+inline void doNotOptimize(const void *p) { asm volatile("" : : "g"(p) : "memory"); }
+
+const int SIZES[] = {8, 64, 512, 4096, 32768, 262144};
+
+// ---------------------------------------------------------------------------------------------
+// SIMD portátil (extensões de vetor do GCC/Clang: SSE no x86, NEON no ARM)
+
+typedef float f4 __attribute__((vector_size(16)));
+typedef int i4 __attribute__((vector_size(16)));
+
+inline f4 select4(i4 mask, f4 a, f4 b) { return (f4)((mask & (i4)a) | (~mask & (i4)b)); }
+
+// Seno e cosseno de 4 ângulos (x > -1600): redução ao quadrante e polinômios do Cephes,
+// erro < 1e-6 até ângulos da ordem de 1e3
+inline void sincos4(f4 x, f4 &s, f4 &c)
+{
+    i4 q = __builtin_convertvector(x * 0.63661977236f + 1024.5f, i4) - 1024;
+    f4 qf = __builtin_convertvector(q, f4);
+    f4 r = ((x - qf * 1.5703125f) - qf * 4.837512969970703125e-4f) - qf * 7.549789948768648e-8f;
+    f4 r2 = r * r;
+    f4 ps = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    f4 pc = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+    i4 swap = (q & 1) != 0;
+    i4 sinSign = (q & 2) << 30;
+    i4 cosSign = ((q + 1) & 2) << 30;
+    s = (f4)((i4)select4(swap, pc, ps) ^ sinSign);
+    c = (f4)((i4)select4(swap, ps, pc) ^ cosSign);
+}
+
+// ---------------------------------------------------------------------------------------------
+// Kernels: arco em leque (círculo, PacMan), xyz por vértice como nas atividades
+
+constexpr float PI = 3.1415926f;
+constexpr int RESYNC = 64; // a recorrência volta ao cosf/sinf exato a cada 64 vértices
+
+// Como no setupGeometry do Octagono e no generatePacmanVertices: cosf/sinf por vértice
+void arcScalar(float *v, int segments, float cx, float cy, float r, float start, float end)
+{
+    v[0] = cx, v[1] = cy, v[2] = 0.0f;
+    for (int i = 0; i <= segments; ++i) {
+        float theta = start + (end - start) * float(i) / segments;
+        v[(i + 1) * 3 + 0] = cx + r * cosf(theta);
+        v[(i + 1) * 3 + 1] = cy + r * sinf(theta);
+        v[(i + 1) * 3 + 2] = 0.0f;
+    }
+}
+
+// Rotação incremental: (c, s) *= (cos d, sin d), dois produtos por vértice
+void arcRecurrence(float *v, int segments, float cx, float cy, float r, float start, float end)
+{
+    v[0] = cx, v[1] = cy, v[2] = 0.0f;
+    float step = (end - start) / segments;
+    float cd = cosf(step), sd = sinf(step);
+    float c = 0.0f, s = 0.0f;
+    for (int i = 0; i <= segments; ++i) {
+        if (i % RESYNC == 0) {
+            c = cosf(start + step * i);
+            s = sinf(start + step * i);
+        }
+        v[(i + 1) * 3 + 0] = cx + r * c;
+        v[(i + 1) * 3 + 1] = cy + r * s;
+        v[(i + 1) * 3 + 2] = 0.0f;
+        float next = c * cd - s * sd;
+        s = s * cd + c * sd;
+        c = next;
+    }
+}
+
+// Tabela do círculo unitário (montada fora da medição, como um nível de LOD reaproveitado)
+struct ArcTable
+{
+    int segments = -1;
+    std::vector<float> cosines, sines;
+};
+
+void buildArcTable(ArcTable &t, int segments, float start, float end)
+{
+    t.segments = segments;
+    t.cosines.resize(segments + 1);
+    t.sines.resize(segments + 1);
+    for (int i = 0; i <= segments; ++i) {
+        float theta = start + (end - start) * float(i) / segments;
+        t.cosines[i] = cosf(theta);
+        t.sines[i] = sinf(theta);
+    }
+}
+
+void arcTable(float *v, const ArcTable &t, float cx, float cy, float r)
+{
+    v[0] = cx, v[1] = cy, v[2] = 0.0f;
+    for (int i = 0; i <= t.segments; ++i) {
+        v[(i + 1) * 3 + 0] = cx + r * t.cosines[i];
+        v[(i + 1) * 3 + 1] = cy + r * t.sines[i];
+        v[(i + 1) * 3 + 2] = 0.0f;
+    }
+}
+
+void arcSimd(float *v, int segments, float cx, float cy, float r, float start, float end)
+{
+    v[0] = cx, v[1] = cy, v[2] = 0.0f;
+    float step = (end - start) / segments;
+    const f4 lane = {0.0f, 1.0f, 2.0f, 3.0f};
+    int i = 0;
+    for (; i + 4 <= segments + 1; i += 4) {
+        f4 s, c;
+        sincos4(start + (float(i) + lane) * step, s, c);
+        f4 x = cx + r * c, y = cy + r * s;
+        float *out = v + (i + 1) * 3;
+        for (int k = 0; k < 4; ++k) {
+            out[3 * k + 0] = x[k];
+            out[3 * k + 1] = y[k];
+            out[3 * k + 2] = 0.0f;
+        }
+    }
+    for (; i <= segments; ++i) {
+        float theta = start + step * i;
+        v[(i + 1) * 3 + 0] = cx + r * cosf(theta);
+        v[(i + 1) * 3 + 1] = cy + r * sinf(theta);
+        v[(i + 1) * 3 + 2] = 0.0f;
+    }
+}
+
+// PacMan como no original: std::vector com push_back a cada coordenada
+void pacmanPushBack(std::vector<float> &vertices, int segments, float mouth)
+{
+    float cx = 0.0f, cy = 0.0f, r = 0.5f;
+    float start = mouth, end = 2.0f * PI - mouth;
+    vertices.clear();
+    vertices.push_back(cx);
+    vertices.push_back(cy);
+    vertices.push_back(0.0f);
+    for (int i = 0; i <= segments; ++i) {
+        float theta = start + (end - start) * float(i) / segments;
+        vertices.push_back(cx + r * cosf(theta));
+        vertices.push_back(cy + r * sinf(theta));
+        vertices.push_back(0.0f);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// Estrela: raio alternado entre externo e interno, começando em -90 graus
+
+void starScalar(float *v, int n)
+{
+    const float rOuter = 0.5f, rInner = 0.22f;
+    v[0] = v[1] = v[2] = 0.0f;
+    for (int i = 0; i <= n; ++i) {
+        float angle = 2.0f * float(M_PI) * float(i) / float(n);
+        float r = (i % 2 == 0) ? rOuter : rInner;
+        v[(i + 1) * 3 + 0] = r * cosf(angle - float(M_PI_2));
+        v[(i + 1) * 3 + 1] = r * sinf(angle - float(M_PI_2));
+        v[(i + 1) * 3 + 2] = 0.0f;
+    }
+}
+
+void starSimd(float *v, int n)
+{
+    const f4 lane = {0.0f, 1.0f, 2.0f, 3.0f};
+    const f4 radius = {0.5f, 0.22f, 0.5f, 0.22f}; // i começa par em cada bloco de 4
+    float step = 2.0f * float(M_PI) / float(n);
+    v[0] = v[1] = v[2] = 0.0f;
+    int i = 0;
+    for (; i + 4 <= n + 1; i += 4) {
+        f4 s, c;
+        sincos4((float(i) + lane) * step - float(M_PI_2), s, c);
+        f4 x = radius * c, y = radius * s;
+        float *out = v + (i + 1) * 3;
+        for (int k = 0; k < 4; ++k) {
+            out[3 * k + 0] = x[k];
+            out[3 * k + 1] = y[k];
+            out[3 * k + 2] = 0.0f;
+        }
+    }
+    for (; i <= n; ++i) {
+        float r = (i % 2 == 0) ? 0.5f : 0.22f;
+        v[(i + 1) * 3 + 0] = r * cosf(step * i - float(M_PI_2));
+        v[(i + 1) * 3 + 1] = r * sinf(step * i - float(M_PI_2));
+        v[(i + 1) * 3 + 2] = 0.0f;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// Espiral de Arquimedes com raio limitado (extendSpiral do Espiral.cpp, constantes do spiral.h)
+
+void spiralScalar(float *v, int points)
+{
+    for (int i = 0; i < points; i++) {
+        float theta = i * SPIRAL_THETA_STEP;
+        float r = SPIRAL_B * theta;
+        if (r > SPIRAL_MAX_RADIUS)
+            r = SPIRAL_MAX_RADIUS;
+        v[i * 3 + 0] = r * cosf(theta);
+        v[i * 3 + 1] = r * sinf(theta);
+        v[i * 3 + 2] = 0.0f;
+    }
+}
+
+void spiralRecurrence(float *v, int points)
+{
+    float cd = cosf(SPIRAL_THETA_STEP), sd = sinf(SPIRAL_THETA_STEP);
+    float c = 1.0f, s = 0.0f;
+    for (int i = 0; i < points; i++) {
+        if (i % RESYNC == 0) {
+            c = cosf(i * SPIRAL_THETA_STEP);
+            s = sinf(i * SPIRAL_THETA_STEP);
+        }
+        float r = std::min(SPIRAL_B * (i * SPIRAL_THETA_STEP), SPIRAL_MAX_RADIUS);
+        v[i * 3 + 0] = r * c;
+        v[i * 3 + 1] = r * s;
+        v[i * 3 + 2] = 0.0f;
+        float next = c * cd - s * sd;
+        s = s * cd + c * sd;
+        c = next;
+    }
+}
+
+// Ângulos grandes perdem precisão na redução de quadrante: o SIMD só cobre a parte em que
+// theta < 1000 (os primeiros ~2800 pontos) e o resto cai no escalar
+void spiralSimd(float *v, int points)
+{
+    const f4 lane = {0.0f, 1.0f, 2.0f, 3.0f};
+    const f4 maxRadius = {SPIRAL_MAX_RADIUS, SPIRAL_MAX_RADIUS, SPIRAL_MAX_RADIUS, SPIRAL_MAX_RADIUS};
+    int simdPoints = std::min(points, int(1000.0f / SPIRAL_THETA_STEP));
+    int i = 0;
+    for (; i + 4 <= simdPoints; i += 4) {
+        f4 theta = (float(i) + lane) * SPIRAL_THETA_STEP;
+        f4 r = SPIRAL_B * theta;
+        r = select4(r > maxRadius, maxRadius, r);
+        f4 s, c;
+        sincos4(theta, s, c);
+        f4 x = r * c, y = r * s;
+        for (int k = 0; k < 4; ++k) {
+            v[(i + k) * 3 + 0] = x[k];
+            v[(i + k) * 3 + 1] = y[k];
+            v[(i + k) * 3 + 2] = 0.0f;
+        }
+    }
+    for (; i < points; i++) {
+        float theta = i * SPIRAL_THETA_STEP;
+        float r = std::min(SPIRAL_B * theta, SPIRAL_MAX_RADIUS);
+        v[i * 3 + 0] = r * cosf(theta);
+        v[i * 3 + 1] = r * sinf(theta);
+        v[i * 3 + 2] = 0.0f;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------
+// Segmentos do drawDashedLine (ViewportCom4Quadrante): 6 floats por traço
+
+constexpr float DASH = 10.0f, GAP = 10.0f;
+
+// Como no original: d acumulado em float e std::min por traço
+int dashesAccumulate(float *out, float x1, float y1, float x2, float y2)
+{
+    float dx = x2 - x1, dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    float vx = dx / length, vy = dy / length;
+    int n = 0;
+    for (float d = 0; d < length; d += DASH + GAP) {
+        float segEnd = std::min(d + DASH, length);
+        float *o = out + 6 * n++;
+        o[0] = x1 + vx * d, o[1] = y1 + vy * d, o[2] = 0.0f;
+        o[3] = x1 + vx * segEnd, o[4] = y1 + vy * segEnd, o[5] = 0.0f;
+    }
+    return n;
+}
+
+// Contagem calculada antes e cada traço a partir do índice: iterações independentes, que o
+// compilador vetoriza; só o último traço é cortado no fim da linha
+int dashesIndexed(float *out, float x1, float y1, float x2, float y2)
+{
+    float dx = x2 - x1, dy = y2 - y1;
+    float length = std::sqrt(dx * dx + dy * dy);
+    float vx = dx / length, vy = dy / length;
+    int n = int(std::ceil(length / (DASH + GAP)));
+    for (int i = 0; i < n; ++i) {
+        float d = i * (DASH + GAP);
+        float *o = out + 6 * i;
+        o[0] = x1 + vx * d, o[1] = y1 + vy * d, o[2] = 0.0f;
+        o[3] = x1 + vx * (d + DASH), o[4] = y1 + vy * (d + DASH), o[5] = 0.0f;
+    }
+    if (n > 0) {
+        float last = std::min((n - 1) * (DASH + GAP) + DASH, length);
+        out[6 * (n - 1) + 3] = x1 + vx * last;
+        out[6 * (n - 1) + 4] = y1 + vy * last;
+    }
+    return n;
+}
+
+// ---------------------------------------------------------------------------------------------
+// Casos de benchmark
+
+std::vector<float> buffer; // saída compartilhada, alocada fora da medição
+
+float *output(int floats)
+{
+    if (buffer.size() < size_t(floats))
+        buffer.resize(floats);
+    return buffer.data();
+}
+
+void countVertices(MicroState &state, double vertices)
+{
+    state.items = vertices;
+    state.bytes = vertices * 3 * sizeof(float);
+}
+
+void circulo_escalar(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        arcScalar(v, state.size, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void circulo_recorrencia(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        arcRecurrence(v, state.size, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void circulo_tabela(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    ArcTable table;
+    buildArcTable(table, state.size, 0.0f, 2.0f * PI);
+    for (long it = 0; it < state.iterations; ++it) {
+        arcTable(v, table, 0.0f, 0.0f, 0.5f);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void circulo_simd(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        arcSimd(v, state.size, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void pacman_push_back(MicroState &state)
+{
+    std::vector<float> vertices;
+    for (long it = 0; it < state.iterations; ++it) {
+        pacmanPushBack(vertices, state.size, 0.2f * PI);
+        doNotOptimize(vertices.data());
+    }
+    countVertices(state, state.size + 2);
+}
+
+// Mesmo arco escrito direto em um buffer já reservado, com a variante SIMD
+void pacman_buffer_simd(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        arcSimd(v, state.size, 0.0f, 0.0f, 0.5f, 0.2f * PI, 1.8f * PI);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void estrela_escalar(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        starScalar(v, state.size);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void estrela_simd(MicroState &state)
+{
+    float *v = output((state.size + 2) * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        starSimd(v, state.size);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size + 2);
+}
+
+void espiral_escalar(MicroState &state)
+{
+    float *v = output(state.size * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        spiralScalar(v, state.size);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size);
+}
+
+void espiral_recorrencia(MicroState &state)
+{
+    float *v = output(state.size * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        spiralRecurrence(v, state.size);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size);
+}
+
+void espiral_simd(MicroState &state)
+{
+    float *v = output(state.size * 3);
+    for (long it = 0; it < state.iterations; ++it) {
+        spiralSimd(v, state.size);
+        doNotOptimize(v);
+    }
+    countVertices(state, state.size);
+}
+
+// Tamanho = número de traços: a linha mede size * (DASH + GAP) pixels
+void tracejado_acumulado(MicroState &state)
+{
+    float *v = output(state.size * 6 + 6);
+    float length = state.size * (DASH + GAP);
+    int n = 0;
+    for (long it = 0; it < state.iterations; ++it) {
+        n = dashesAccumulate(v, 0.0f, 0.0f, length * 0.6f, length * 0.8f);
+        doNotOptimize(v);
+    }
+    state.items = 2.0 * n;
+    state.bytes = n * 6.0 * sizeof(float);
+}
+
+void tracejado_indexado(MicroState &state)
+{
+    float *v = output(state.size * 6 + 6);
+    float length = state.size * (DASH + GAP);
+    int n = 0;
+    for (long it = 0; it < state.iterations; ++it) {
+        n = dashesIndexed(v, 0.0f, 0.0f, length * 0.6f, length * 0.8f);
+        doNotOptimize(v);
+    }
+    state.items = 2.0 * n;
+    state.bytes = n * 6.0 * sizeof(float);
+}
+
+MICRO_BENCHMARK(circulo_escalar);
+MICRO_BENCHMARK(circulo_recorrencia);
+MICRO_BENCHMARK(circulo_tabela);
+MICRO_BENCHMARK(circulo_simd);
+MICRO_BENCHMARK(pacman_push_back);
+MICRO_BENCHMARK(pacman_buffer_simd);
+MICRO_BENCHMARK(estrela_escalar);
+MICRO_BENCHMARK(estrela_simd);
+MICRO_BENCHMARK(espiral_escalar);
+MICRO_BENCHMARK(espiral_recorrencia);
+MICRO_BENCHMARK(espiral_simd);
+MICRO_BENCHMARK(tracejado_acumulado);
+MICRO_BENCHMARK(tracejado_indexado);
+
+// ---------------------------------------------------------------------------------------------
+// Verificação: cada variante contra a escalar, no maior tamanho
+
+float maxError(const std::vector<float> &a, const std::vector<float> &b)
+{
+    float error = 0.0f;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+        error = std::max(error, std::fabs(a[i] - b[i]));
+    return a.size() == b.size() ? error : INFINITY;
+}
+
+void verifyKernels()
+{
+    const int n = SIZES[sizeof(SIZES) / sizeof(SIZES[0]) - 1];
+    std::vector<float> ref((n + 2) * 3), test((n + 2) * 3);
+    arcScalar(ref.data(), n, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+    arcRecurrence(test.data(), n, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+    printf("verificação (erro máximo em %d vértices):\n  circulo_recorrencia %.2e\n", n, maxError(ref, test));
+    ArcTable table;
+    buildArcTable(table, n, 0.0f, 2.0f * PI);
+    arcTable(test.data(), table, 0.0f, 0.0f, 0.5f);
+    printf("  circulo_tabela      %.2e\n", maxError(ref, test));
+    arcSimd(test.data(), n, 0.0f, 0.0f, 0.5f, 0.0f, 2.0f * PI);
+    printf("  circulo_simd        %.2e\n", maxError(ref, test));
+    starScalar(ref.data(), n);
+    starSimd(test.data(), n);
+    printf("  estrela_simd        %.2e\n", maxError(ref, test));
+    ref.assign(n * 3, 0.0f);
+    test.assign(n * 3, 0.0f);
+    spiralScalar(ref.data(), n);
+    spiralRecurrence(test.data(), n);
+    printf("  espiral_recorrencia %.2e\n", maxError(ref, test));
+    spiralSimd(test.data(), n);
+    printf("  espiral_simd        %.2e\n", maxError(ref, test));
+    ref.assign(n * 6 + 6, 0.0f);
+    test.assign(n * 6 + 6, 0.0f);
+    float length = n * (DASH + GAP) - 3.0f; // último traço cortado
+    int a = dashesAccumulate(ref.data(), 0.0f, 0.0f, length * 0.6f, length * 0.8f);
+    int b = dashesIndexed(test.data(), 0.0f, 0.0f, length * 0.6f, length * 0.8f);
+    printf("  tracejado_indexado  %.2e (%d e %d traços)\n\n", maxError(ref, test), a, b);
+}
+
+// ---------------------------------------------------------------------------------------------
+
+const char *humanRate(double perSecond, char *text, size_t size, const char *unit)
+{
+    const char *prefixes[] = {"", "k", "M", "G", "T"};
+    int p = 0;
+    for (; perSecond >= 1000.0 && p < 4; ++p)
+        perSecond /= 1000.0;
+    snprintf(text, size, "%.2f%s%s/s", perSecond, prefixes[p], unit);
+    return text;
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = nullptr;
+    double minTime = 0.1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--filtro") == 0)
+            filter = argv[i + 1];
+        else if (strcmp(argv[i], "--min-tempo") == 0)
+            minTime = atof(argv[i + 1]);
+    }
+
+    verifyKernels();
+    printf("%-32s %14s %12s %16s %16s\n", "Benchmark", "Tempo", "Iterações", "vértices", "bytes");
+    printf("%s\n", std::string(96, '-').c_str());
+    for (const MicroBenchmark &bench : microRegistry()) {
+        for (int size : SIZES) {
+            std::string name = bench.name + "/" + std::to_string(size);
+            if (filter && name.find(filter) == std::string::npos)
+                continue;
+            // Dobra as iterações até a medição passar do tempo mínimo
+            MicroState state{size, 1};
+            double seconds = 0.0;
+            for (;;) {
+                auto start = std::chrono::steady_clock::now();
+                bench.function(state);
+                seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (seconds >= minTime || state.iterations >= (1L << 40))
+                    break;
+                long next = seconds > 0.0 ? long(state.iterations * std::min(10.0, 1.4 * minTime / seconds)) : 0;
+                state.iterations = std::max(state.iterations * 2, next);
+            }
+            double perIteration = seconds / state.iterations;
+            char items[32], bytes[32];
+            printf("%-32s %11.1f ns %12ld %16s %16s\n", name.c_str(), perIteration * 1e9, state.iterations,
+                   humanRate(state.items / perIteration, items, sizeof(items), ""),
+                   humanRate(state.bytes / perIteration, bytes, sizeof(bytes), "B"));
+        }
+    }
+    return 0;
+}
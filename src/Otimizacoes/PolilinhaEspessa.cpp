@@ -0,0 +1,269 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "polyline.h"
+
+// Linhas espessas com anti-aliasing pelo Commun/polyline.h, comparadas ao GL_LINE_STRIP
+// (limitado a 1 pixel no core profile). Cena: estrela fechada, espiral e senoide.
+// Com --bench N, uma caminhada aleatória de N segmentos desenhada em uma chamada.
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr int BENCH_FRAMES = 100;
+
+// GL_LINE_STRIP de referência, com a mesma cor uniforme
+const char *lineVertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+void main() {
+    gl_Position = vec4(position, 1.0);
+}
+)";
+
+const char *lineFragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+float lineWidth = 12.0f;
+PolylineJoin join = POLYLINE_MITER;
+const char *const JOIN_NAMES[3] = {"quina", "arredondada", "chanfrada"};
+bool useLineStrip = false;
+
+// Callback de teclado: ESC fecha, J troca a junção, L alterna GL_LINE_STRIP, setas mudam a largura
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (action != GLFW_PRESS && action != GLFW_REPEAT)
+        return;
+    if (key == GLFW_KEY_J)
+        join = join == POLYLINE_MITER ? POLYLINE_BEVEL : (join == POLYLINE_BEVEL ? POLYLINE_ROUND : POLYLINE_MITER);
+    if (key == GLFW_KEY_L)
+        useLineStrip = !useLineStrip;
+    if (key == GLFW_KEY_UP)
+        lineWidth = std::min(lineWidth + 1.0f, 64.0f);
+    if (key == GLFW_KEY_DOWN)
+        lineWidth = std::max(lineWidth - 1.0f, 1.0f);
+}
+
+// Uma forma da cena: pontos (x, y, z), fechada ou não, e cor
+struct Stroke
+{
+    std::vector<float> points;
+    bool closed;
+    float r, g, b;
+    Polyline line;
+    GLuint VAO, VBO; // mesmos pontos para o GL_LINE_STRIP / GL_LINE_LOOP
+};
+
+// Forma ainda sem buffers (criados no setupStroke)
+Stroke makeStroke(std::vector<float> points, bool closed, float r, float g, float b)
+{
+    Stroke s;
+    s.points = std::move(points);
+    s.closed = closed;
+    s.r = r;
+    s.g = g;
+    s.b = b;
+    s.line = Polyline();
+    s.VAO = s.VBO = 0;
+    return s;
+}
+
+std::vector<float> starPoints(float cx, float cy, float outer, float inner, int tips)
+{
+    std::vector<float> p;
+    for (int i = 0; i < 2 * tips; ++i) {
+        float angle = 3.1415926f * 0.5f + i * 3.1415926f / tips;
+        float radius = i % 2 == 0 ? outer : inner;
+        p.insert(p.end(), {cx + radius * cosf(angle), cy + radius * sinf(angle), 0.0f});
+    }
+    return p;
+}
+
+std::vector<float> spiralPoints(float cx, float cy, float maxRadius, int n)
+{
+    std::vector<float> p;
+    for (int i = 0; i < n; ++i) {
+        float theta = i * 0.15f;
+        float radius = maxRadius * i / (n - 1);
+        p.insert(p.end(), {cx + radius * cosf(theta), cy + radius * sinf(theta), 0.0f});
+    }
+    return p;
+}
+
+std::vector<float> sinePoints(float y, float amplitude, int n)
+{
+    std::vector<float> p;
+    for (int i = 0; i < n; ++i) {
+        float x = -0.9f + 1.8f * i / (n - 1);
+        p.insert(p.end(), {x, y + amplitude * sinf(x * 12.0f), 0.0f});
+    }
+    return p;
+}
+
+// Caminhada aleatória de 'segments' segmentos dentro da tela
+std::vector<float> randomWalkPoints(int segments)
+{
+    std::mt19937 rng{11};
+    std::normal_distribution<float> step(0.0f, 0.01f);
+    std::vector<float> p;
+    p.reserve(size_t(segments + 1) * 3);
+    float x = 0.0f, y = 0.0f;
+    for (int i = 0; i <= segments; ++i) {
+        x = std::clamp(x + step(rng), -0.95f, 0.95f);
+        y = std::clamp(y + step(rng), -0.95f, 0.95f);
+        p.insert(p.end(), {x, y, 0.0f});
+    }
+    return p;
+}
+
+void setupStroke(Stroke &s)
+{
+    s.line = createPolyline();
+    polylineUpload(s.line, s.points.data(), s.points.size() / 3, s.closed);
+
+    glGenVertexArrays(1, &s.VAO);
+    glGenBuffers(1, &s.VBO);
+    glBindVertexArray(s.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, s.VBO);
+    glBufferData(GL_ARRAY_BUFFER, s.points.size() * sizeof(float), s.points.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void drawStroke(const Stroke &s, const PolylineShader &polylineShader, GLuint lineShader, GLint colorLoc,
+                int width, int height)
+{
+    if (useLineStrip) {
+        glUseProgram(lineShader);
+        glUniform4f(colorLoc, s.r, s.g, s.b, 1.0f); // sempre 1 pixel: glLineWidth > 1 é erro no core
+        glBindVertexArray(s.VAO);
+        glDrawArrays(s.closed ? GL_LINE_LOOP : GL_LINE_STRIP, 0, GLsizei(s.points.size() / 3));
+        glBindVertexArray(0);
+    } else {
+        polylineDraw(polylineShader, s.line, lineWidth, join, s.r, s.g, s.b, 1.0f, width, height);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int benchSegments = 0;
+    if (argc > 2 && strcmp(argv[1], "--bench") == 0)
+        benchSegments = std::max(1, atoi(argv[2]));
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Polilinhas espessas", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    PolylineShader polylineShader = createPolylineShader();
+    GLuint lineShader = buildShaderProgram(lineVertexShaderSource, lineFragmentShaderSource);
+    GLint colorLoc = glGetUniformLocation(lineShader, "inputColor");
+
+    std::vector<Stroke> strokes;
+    if (benchSegments > 0) {
+        lineWidth = 2.0f;
+        strokes.push_back(makeStroke(randomWalkPoints(benchSegments), false, 0.3f, 0.8f, 1.0f));
+    } else {
+        strokes.push_back(makeStroke(starPoints(-0.45f, 0.45f, 0.4f, 0.16f, 5), true, 1.0f, 0.85f, 0.1f));
+        strokes.push_back(makeStroke(spiralPoints(0.45f, 0.45f, 0.4f, 200), false, 1.0f, 0.2f, 0.2f));
+        strokes.push_back(makeStroke(sinePoints(-0.5f, 0.3f, 120), false, 0.3f, 0.8f, 1.0f));
+    }
+    for (Stroke &s : strokes)
+        setupStroke(s);
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+    int frame = 0;
+    double modeTime[2] = {0.0, 0.0};
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Polilinhas espessas (%s, %.0f px) \tFPS %.2lf",
+                     useLineStrip ? "GL_LINE_STRIP" : JOIN_NAMES[join],
+                     lineWidth, 1.0 / elapsed_s);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+
+        // Benchmark: primeira metade com polilinha espessa, segunda com GL_LINE_STRIP
+        if (benchSegments > 0)
+            useLineStrip = frame >= BENCH_FRAMES;
+        double frameStart = glfwGetTime();
+
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (const Stroke &s : strokes)
+            drawStroke(s, polylineShader, lineShader, colorLoc, width, height);
+
+        if (benchSegments > 0) {
+            glFinish();
+            modeTime[useLineStrip] += glfwGetTime() - frameStart;
+            if (++frame == 2 * BENCH_FRAMES) {
+                printf("%d segmentos: polilinha %.2f px = %.3f ms/frame, GL_LINE_STRIP = %.3f ms/frame\n",
+                       benchSegments, lineWidth, 1000.0 * modeTime[0] / BENCH_FRAMES,
+                       1000.0 * modeTime[1] / BENCH_FRAMES);
+                glfwSetWindowShouldClose(window, GL_TRUE);
+            }
+        }
+
+        glfwSwapBuffers(window);
+    }
+
+    for (Stroke &s : strokes) {
+        deletePolyline(s.line);
+        glDeleteVertexArrays(1, &s.VAO);
+        glDeleteBuffers(1, &s.VBO);
+    }
+    deletePolylineShader(polylineShader);
+    glDeleteProgram(lineShader);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
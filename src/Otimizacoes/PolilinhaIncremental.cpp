@@ -0,0 +1,165 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "stream_buffer.h"
+
+// Plotagem ao vivo de uma polilinha longa: a cada frame novas amostras são anexadas ao
+// final de um buffer que cresce na GPU (Commun/stream_buffer.h) e só essa cauda é enviada.
+// O modo "regerar" reenvia a polilinha inteira a cada frame, como faria um setup refeito.
+// Cada vértice guarda (índice, valor); a escala para a tela sai de uniforms.
+
+constexpr GLuint WIDTH = 1000, HEIGHT = 600;
+constexpr int DEFAULT_POINTS_PER_FRAME = 2000;
+constexpr int DEFAULT_MAX_POINTS = 2000000;
+
+const char *vertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec2 point;    // índice, valor
+uniform float u_count;                  // amostras visíveis
+void main() {
+    float x = -0.98 + 1.96 * point.x / max(u_count - 1.0, 1.0);
+    gl_Position = vec4(x, 0.9 * point.y, 0.0, 1.0);
+}
+)";
+
+const char *fragmentShaderSource = R"(
+#version 400
+out vec4 color;
+void main() {
+    color = vec4(0.2, 0.9, 0.4, 1.0);
+}
+)";
+
+bool regenerate = false;
+
+// Callback de teclado: ESC fecha, R alterna entre anexar e regerar tudo
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_R && action == GLFW_PRESS)
+        regenerate = !regenerate;
+}
+
+// Sinal de exemplo: soma de senoides com uma modulação lenta, limitado a [-1, 1]
+float signalAt(long i)
+{
+    float t = float(i) * 0.001f;
+    return 0.6f * sinf(t * 7.0f) * cosf(t * 0.13f) + 0.3f * sinf(t * 53.0f) + 0.1f * sinf(t * 331.0f);
+}
+
+int main(int argc, char **argv)
+{
+    int pointsPerFrame = argc > 1 ? std::max(1, atoi(argv[1])) : DEFAULT_POINTS_PER_FRAME;
+    int maxPoints = argc > 2 ? std::max(pointsPerFrame, atoi(argv[2])) : DEFAULT_MAX_POINTS;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Polilinha incremental", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    glViewport(0, 0, width, height);
+
+    GLuint shaderProgram = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
+    GLint countLoc = glGetUniformLocation(shaderProgram, "u_count");
+
+    StreamBuffer plot = createStreamBuffer(2);
+    std::vector<float> samples;     // cópia na CPU, usada apenas pelo modo regerar
+    samples.reserve(size_t(maxPoints) * 2);
+    long nextIndex = 0;
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+    double uploadedSum[2] = {0.0, 0.0};
+    int framesPerMode[2] = {0, 0};
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+
+        glfwPollEvents();
+
+        // Ao atingir o limite, o plot recomeça (o buffer mantém a capacidade)
+        if (plot.count + pointsPerFrame > maxPoints) {
+            streamClear(plot);
+            samples.clear();
+            nextIndex = 0;
+        }
+
+        size_t first = samples.size();
+        for (int i = 0; i < pointsPerFrame; ++i, ++nextIndex) {
+            samples.push_back(float(nextIndex));
+            samples.push_back(signalAt(nextIndex));
+        }
+
+        streamResetStats(plot);
+        if (regenerate) {
+            // Reenvia tudo desde o início, como um setupSpiral refeito a cada mudança
+            streamClear(plot);
+            streamAppend(plot, samples.data(), GLsizeiptr(samples.size() / 2));
+        } else {
+            streamAppend(plot, samples.data() + first, pointsPerFrame);
+        }
+        uploadedSum[regenerate] += double(plot.uploadedBytes);
+        framesPerMode[regenerate]++;
+
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[200];
+            snprintf(tmp, sizeof(tmp), "Polilinha incremental (%s) \tFPS %.2lf \tpontos %ld \tenviados/frame %.1f KB",
+                     regenerate ? "regerar" : "anexar", 1.0 / elapsed_s, long(plot.count),
+                     plot.uploadedBytes / 1024.0);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glUseProgram(shaderProgram);
+        glUniform1f(countLoc, float(plot.count));
+        streamDraw(plot, GL_LINE_STRIP);
+
+        glfwSwapBuffers(window);
+    }
+
+    for (int mode = 0; mode < 2; ++mode)
+        if (framesPerMode[mode] > 0)
+            printf("%s: %d frames, %.1f KB enviados por frame em média\n", mode ? "regerar" : "anexar",
+                   framesPerMode[mode], uploadedSum[mode] / framesPerMode[mode] / 1024.0);
+
+    deleteStreamBuffer(plot);
+    glDeleteProgram(shaderProgram);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include "lod_math.h"
+#include "soft_raster.h"
+
+// Renderiza desenhos das atividades sem GPU (nem contexto GL), com o rasterizador em tiles do
+// soft_raster.h, e grava cada imagem em PNG. Serve para máquinas de CI sem placa de vídeo.
+// Uso: RasterizadorCPU [--saida pasta] [--threads N] [--bench N]
+//   --bench N desenha N triângulos aleatórios com 1, 2, 4... threads e mostra o ganho
+
+constexpr float PI = 3.1415926f;
+
+// Casa do DesenhoCuston: mesmos vértices, cores e índices, com cor interpolada
+void drawHouse(SoftRaster &raster)
+{
+    const SoftVertex vertices[] = {
+        // Telhado
+        {0.0f, 0.7f, 0.8f, 0.0f, 0.0f, 1.0f},
+        {-0.6f, 0.3f, 0.8f, 0.0f, 0.0f, 1.0f},
+        {0.6f, 0.3f, 0.8f, 0.0f, 0.0f, 1.0f},
+        // Corpo
+        {-0.6f, 0.3f, 1.0f, 1.0f, 1.0f, 1.0f},
+        {0.6f, 0.3f, 1.0f, 1.0f, 1.0f, 1.0f},
+        {0.6f, -0.5f, 1.0f, 1.0f, 1.0f, 1.0f},
+        {-0.6f, -0.5f, 1.0f, 1.0f, 1.0f, 1.0f},
+        // Porta
+        {-0.15f, -0.5f, 0.4f, 0.2f, 0.2f, 1.0f},
+        {0.15f, -0.5f, 0.4f, 0.2f, 0.2f, 1.0f},
+        {0.15f, -0.1f, 0.4f, 0.2f, 0.2f, 1.0f},
+        {-0.15f, -0.1f, 0.4f, 0.2f, 0.2f, 1.0f},
+        // Janela
+        {-0.35f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f},
+        {-0.15f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f},
+        {-0.15f, 0.2f, 1.0f, 1.0f, 0.0f, 1.0f},
+        {-0.35f, 0.2f, 1.0f, 1.0f, 0.0f, 1.0f},
+        // Chão
+        {-1.0f, -0.5f, 1.0f, 0.5f, 0.0f, 1.0f},
+        {1.0f, -0.5f, 1.0f, 0.5f, 0.0f, 1.0f},
+        {1.0f, -0.7f, 1.0f, 0.5f, 0.0f, 1.0f},
+        {-1.0f, -0.7f, 1.0f, 0.5f, 0.0f, 1.0f},
+    };
+    const unsigned indices[] = {0, 1, 2, 3, 4, 5, 3, 5, 6, 7, 8, 9, 7, 9, 10, 11, 12, 13, 11, 13, 14, 15, 16, 17, 15, 17, 18};
+
+    softClear(raster, 0.7f, 0.9f, 1.0f, 1.0f);
+    softDrawElements(raster, SOFT_TRIANGLES, vertices, indices, sizeof(indices) / sizeof(indices[0]));
+}
+
+// Leque de círculo (centro + segments + 1 vértices) de cor única
+std::vector<SoftVertex> circleFan(float cx, float cy, float rx, float ry, int segments, float r, float g, float b)
+{
+    std::vector<SoftVertex> fan{{cx, cy, r, g, b, 1.0f}};
+    for (int i = 0; i <= segments; ++i) {
+        float theta = 2.0f * PI * float(i) / float(segments);
+        fan.push_back({cx + rx * cosf(theta), cy + ry * sinf(theta), r, g, b, 1.0f});
+    }
+    return fan;
+}
+
+// Linhas pontilhadas e círculo em 4 viewports, como no ViewportCom4Quadrante (800x600)
+void drawQuadrants(SoftRaster &raster)
+{
+    const int width = 800, height = 600;
+    softViewport(raster, 0, 0, width, height);
+    softClear(raster, 0.05f, 0.05f, 0.05f, 1.0f);
+
+    // Traços de 10 px com intervalos de 10 px, em coordenadas de pixel convertidas para NDC
+    std::vector<SoftVertex> dashes;
+    auto dashedLine = [&](float x1, float y1, float x2, float y2) {
+        float dx = x2 - x1, dy = y2 - y1, length = std::sqrt(dx * dx + dy * dy);
+        for (float d = 0; d < length; d += 20.0f) {
+            float end = std::min(d + 10.0f, length);
+            dashes.push_back({(x1 + dx / length * d) / width * 2 - 1, (y1 + dy / length * d) / height * 2 - 1, 0.5f,
+                              0.5f, 0.5f, 1.0f});
+            dashes.push_back({(x1 + dx / length * end) / width * 2 - 1, (y1 + dy / length * end) / height * 2 - 1,
+                              0.5f, 0.5f, 0.5f, 1.0f});
+        }
+    };
+    dashedLine(width / 2, 0, width / 2, height);
+    dashedLine(0, height / 2, width, height / 2);
+    softDrawArrays(raster, SOFT_LINES, dashes.data(), int(dashes.size()));
+
+    // Círculo de raio 100 px no sistema da janela inteira, desenhado em cada quadrante (50 px na tela)
+    std::vector<SoftVertex> circle = circleFan(0.0f, 0.0f, 100.0f / width * 2, 100.0f / height * 2,
+                                               lodSegmentsForRadius(50.0f), 0.2f, 0.8f, 1.0f);
+    const int quadrants[4][2] = {{0, height / 2}, {width / 2, height / 2}, {0, 0}, {width / 2, 0}};
+    for (const auto &q : quadrants) {
+        softViewport(raster, q[0], q[1], width / 2, height / 2);
+        softDrawArrays(raster, SOFT_TRIANGLE_FAN, circle.data(), int(circle.size()));
+    }
+}
+
+// Octágono (TRIANGLE_FAN), estrela com cor flat, espiral (LINE_STRIP), contorno com
+// LINE_LOOP e pontos, um por quadrante de uma imagem 800x800
+void drawShapes(SoftRaster &raster)
+{
+    const int half = 400;
+    softViewport(raster, 0, 0, 800, 800);
+    softClear(raster, 0.05f, 0.05f, 0.05f, 1.0f);
+
+    softViewport(raster, 0, half, half, half);
+    std::vector<SoftVertex> octagon = circleFan(0.0f, 0.0f, 0.8f, 0.8f, 8, 0.2f, 0.8f, 1.0f);
+    softDrawArrays(raster, SOFT_TRIANGLE_FAN, octagon.data(), int(octagon.size()));
+
+    // Estrela de 5 pontas com uma cor por vértice; em flat cada triângulo fica com a do último
+    softViewport(raster, half, half, half, half);
+    std::vector<SoftVertex> star{{0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f}};
+    for (int i = 0; i <= 10; ++i) {
+        float angle = 2.0f * PI * float(i) / 10.0f - PI / 2.0f;
+        float radius = i % 2 == 0 ? 0.9f : 0.4f;
+        star.push_back({radius * cosf(angle), radius * sinf(angle), i % 3 == 0 ? 1.0f : 0.2f, i % 3 == 1 ? 1.0f : 0.2f,
+                        i % 3 == 2 ? 1.0f : 0.2f, 1.0f});
+    }
+    raster.shading = SOFT_FLAT;
+    softDrawArrays(raster, SOFT_TRIANGLE_FAN, star.data(), int(star.size()));
+    raster.shading = SOFT_SMOOTH;
+
+    softViewport(raster, 0, 0, half, half);
+    std::vector<SoftVertex> spiral;
+    for (int i = 0; i < 400; ++i) {
+        float theta = i * 0.1f, r = 0.02f * theta;
+        spiral.push_back({r * cosf(theta), r * sinf(theta), 1.0f, 0.0f, 0.0f, 1.0f});
+    }
+    raster.lineWidth = 2.0f;
+    softDrawArrays(raster, SOFT_LINE_STRIP, spiral.data(), int(spiral.size()));
+
+    softViewport(raster, half, 0, half, half);
+    const SoftVertex triangle[] = {
+        {-0.8f, -0.7f, 1.0f, 0.0f, 0.0f, 1.0f}, {0.8f, -0.7f, 0.0f, 1.0f, 0.0f, 1.0f}, {0.0f, 0.8f, 0.0f, 0.0f, 1.0f, 1.0f}};
+    raster.lineWidth = 6.0f;
+    softDrawArrays(raster, SOFT_LINE_LOOP, triangle, 3);
+    raster.pointSize = 16.0f;
+    softDrawArrays(raster, SOFT_POINTS, triangle, 3);
+    raster.lineWidth = raster.pointSize = 1.0f;
+}
+
+// Triângulos aleatórios pequenos e semitransparentes, em milhões de triângulos por segundo
+double benchTriangles(int count, int threads)
+{
+    SoftRaster raster;
+    createSoftRaster(raster, 1920, 1080, threads);
+    std::mt19937 rng{1234};
+    std::uniform_real_distribution<float> position(-1.0f, 1.0f), offset(-0.05f, 0.05f), channel(0.0f, 1.0f);
+    std::vector<SoftVertex> vertices(size_t(count) * 3);
+    for (int i = 0; i < count; ++i) {
+        float x = position(rng), y = position(rng);
+        for (int k = 0; k < 3; ++k)
+            vertices[i * 3 + k] = {x + offset(rng), y + offset(rng), channel(rng), channel(rng), channel(rng), 0.5f};
+    }
+    raster.blend = true;
+
+    double best = 1e30;
+    for (int repeat = 0; repeat < 5; ++repeat) {
+        auto start = std::chrono::steady_clock::now();
+        softClear(raster, 0.0f, 0.0f, 0.0f, 1.0f);
+        softDrawArrays(raster, SOFT_TRIANGLES, vertices.data(), count * 3);
+        softFlush(raster);
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    deleteSoftRaster(raster);
+    return count / best / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = ".";
+    int threads = 0, benchCount = 0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--saida") == 0)
+            output = argv[i + 1];
+        else if (strcmp(argv[i], "--threads") == 0)
+            threads = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--bench") == 0)
+            benchCount = atoi(argv[i + 1]);
+    }
+
+    if (benchCount > 0) {
+        int cores = std::max(1, int(std::thread::hardware_concurrency()));
+        double single = 0.0;
+        // 1, 2, 4... threads, e por último todos os núcleos
+        for (int n = 1; n <= cores; n = n < cores && n * 2 > cores ? cores : n * 2) {
+            double rate = benchTriangles(benchCount, n);
+            if (n == 1)
+                single = rate;
+            printf("%2d thread(s): %7.2f M triângulos/s (%.2fx)\n", n, rate, rate / single);
+        }
+        return 0;
+    }
+
+    struct Scene
+    {
+        const char *name;
+        int width, height;
+        void (*draw)(SoftRaster &);
+    };
+    const Scene scenes[] = {{"casa", 800, 600, drawHouse}, {"quadrantes", 800, 600, drawQuadrants}, {"formas", 800, 800, drawShapes}};
+    for (const Scene &scene : scenes) {
+        SoftRaster raster;
+        createSoftRaster(raster, scene.width, scene.height, threads);
+        auto start = std::chrono::steady_clock::now();
+        scene.draw(raster);
+        softFlush(raster);
+        double ms = 1000.0 * std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.png", output, scene.name);
+        if (softSavePng(raster, path))
+            printf("%s (%dx%d, %d threads): %.2f ms\n", path, scene.width, scene.height, raster.threadCount, ms);
+        deleteSoftRaster(raster);
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "gl_trace.h"
+
+// Reproduz um rastro gravado com GL_TRACE_FILE (Commun/gl_trace.h): executa as chamadas
+// de um frame por vez e fecha quando o rastro acaba (não dá para repetir do início: os
+// objetos criados continuam vivos e o driver devolveria IDs novos). Como a reprodução passa
+// pelos mesmos wrappers, ao sair imprime as estatísticas de chamadas por frame.
+// Uso: ReproduzRastro rastro.bin [largura altura]
+
+// Callback de teclado: ESC fecha
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " rastro.bin [largura altura]" << std::endl;
+        return -1;
+    }
+    int width = argc > 3 ? atoi(argv[2]) : 800;
+    int height = argc > 3 ? atoi(argv[3]) : 600;
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(width, height, "Reprodução de rastro GL", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    glTraceInstall();
+    GLTraceReader reader;
+    if (!glTraceReplayOpen(argv[1], reader)) {
+        std::cerr << "Rastro inválido: " << argv[1] << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+
+    while (!glfwWindowShouldClose(window)) {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Reprodução de rastro GL (frame %d, %llu chamadas) \tFPS %.2lf", glTrace.frames,
+                     (unsigned long long)glTrace.lastFrameCalls, 1.0 / elapsed_s);
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
+        glfwPollEvents();
+
+        if (!glTraceReplayFrame(reader))
+            break;
+        glTraceEndFrame();
+        glfwSwapBuffers(window);
+    }
+
+    glTraceReport(stdout);
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,354 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "shader.h"
+#include "markers.h"
+#include "triangulate.h"
+
+// Polígono clicado ponto a ponto e triangulado (Commun/triangulate.h), inclusive côncavo e com
+// furos: o TrianguloComClique só forma um triângulo a cada 3 cliques.
+//
+// Uso: Triangulacao [--exemplo]      botão esquerdo acrescenta um ponto, o direito fecha o anel
+//                                    (o primeiro é o contorno, os seguintes são furos), C limpa
+//      Triangulacao --mede [N]       mede a triangulação de polígonos de até N vértices (1M)
+
+constexpr GLuint WIDTH = 800, HEIGHT = 800;
+constexpr size_t DEFAULT_MAX_VERTICES = 1000000;
+constexpr size_t NAIVE_MAX_VERTICES = 10000; // sem a grade o recorte é O(n²)
+
+// Posição em pixels (y para cima), como no TrianguloComClique
+const char *vertexShaderSource = R"(
+#version 400
+layout (location = 0) in vec3 position;
+void main() {
+    gl_Position = vec4(position.x / 800.0 * 2.0 - 1.0, position.y / 800.0 * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const char *fragmentShaderSource = R"(
+#version 400
+uniform vec4 inputColor;
+out vec4 color;
+void main() {
+    color = inputColor;
+}
+)";
+
+using Clock = std::chrono::steady_clock;
+
+double msSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// --- Polígono em edição ---
+struct Polygon
+{
+    std::vector<float> points;       // (x, y, z) de todos os anéis, o aberto por último
+    std::vector<uint32_t> holeStarts;
+    uint32_t openStart = 0;          // início do anel ainda aberto
+    std::vector<uint32_t> indices;
+    Triangulator triangulator;
+    bool dirty = false;
+};
+
+Polygon polygon;
+
+void closeRing(Polygon &p)
+{
+    uint32_t count = uint32_t(p.points.size() / 3);
+    if (count - p.openStart < 3)
+        return;
+    if (p.openStart > 0)
+        p.holeStarts.push_back(p.openStart);
+    p.openStart = count;
+    auto start = Clock::now();
+    triangulate(p.triangulator, p.points.data(), count, p.holeStarts, p.indices);
+    printf("%u vértices, %zu furos: %zu triângulos em %.3f ms\n", count, p.holeStarts.size(), p.indices.size() / 3,
+           msSince(start));
+    p.dirty = true;
+}
+
+void mouse_button_callback(GLFWwindow *window, int button, int action, int)
+{
+    if (action != GLFW_PRESS)
+        return;
+    if (button == GLFW_MOUSE_BUTTON_LEFT) {
+        double xpos, ypos;
+        glfwGetCursorPos(window, &xpos, &ypos);
+        polygon.points.insert(polygon.points.end(), {float(xpos), float(HEIGHT - ypos), 0.0f});
+        polygon.dirty = true;
+    } else if (button == GLFW_MOUSE_BUTTON_RIGHT) {
+        closeRing(polygon);
+    }
+}
+
+// Callback de teclado: ESC fecha, C limpa o polígono
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_C && action == GLFW_PRESS) {
+        polygon.points.clear();
+        polygon.holeStarts.clear();
+        polygon.indices.clear();
+        polygon.openStart = 0;
+        polygon.dirty = true;
+    }
+}
+
+// --- Polígonos de teste ---
+// Anel de 'count' pontos em volta de (cx, cy); 'jitter' > 0 sorteia o raio em [r - jitter, r]
+void addRing(std::vector<float> &xyz, size_t count, double cx, double cy, double radius, double jitter,
+             std::mt19937 &rng, bool clockwise = false)
+{
+    std::uniform_real_distribution<double> d(-jitter, 0.0);
+    for (size_t i = 0; i < count; ++i) {
+        double angle = 2.0 * M_PI * double(i) / double(count) * (clockwise ? -1.0 : 1.0);
+        double r = radius + (jitter > 0.0 ? d(rng) : 0.0);
+        xyz.insert(xyz.end(), {float(cx + r * cos(angle)), float(cy + r * sin(angle)), 0.0f});
+    }
+}
+
+// Contorno de mapa: círculo com ruído da ordem do espaçamento entre vértices
+void outlinePolygon(size_t n, std::vector<float> &xyz, std::vector<uint32_t> &holes)
+{
+    std::mt19937 rng(42);
+    addRing(xyz, n, 0.0, 0.0, 1.0, 3.0 * 2.0 * M_PI / double(n), rng);
+    holes.clear();
+}
+
+// Espinhos: raio sorteado entre 0,5 e 1 em cada vértice, metade deles côncava; toda orelha
+// atravessa a faixa dos espinhos (caso ruim para a grade)
+void spikesPolygon(size_t n, std::vector<float> &xyz, std::vector<uint32_t> &holes)
+{
+    std::mt19937 rng(42);
+    addRing(xyz, n, 0.0, 0.0, 1.0, 0.5, rng);
+    holes.clear();
+}
+
+// Faixa em espiral de 6 voltas: ida pela borda de fora, volta pela de dentro
+void spiralPolygon(size_t n, std::vector<float> &xyz, std::vector<uint32_t> &holes)
+{
+    size_t half = n / 2;
+    double turns = 6.0, width = 0.04;
+    auto at = [&](size_t i, double offset) {
+        double t = double(i) / double(half - 1), angle = t * turns * 2.0 * M_PI, r = 0.1 + 0.8 * t + offset;
+        xyz.insert(xyz.end(), {float(r * cos(angle)), float(r * sin(angle)), 0.0f});
+    };
+    for (size_t i = 0; i < half; ++i)
+        at(i, width);
+    for (size_t i = half; i-- > 0;)
+        at(i, 0.0);
+    holes.clear();
+}
+
+// Disco com 10x10 furos redondos: metade dos vértices no contorno, metade nos furos
+void holesPolygon(size_t n, std::vector<float> &xyz, std::vector<uint32_t> &holes)
+{
+    std::mt19937 rng(42);
+    const int side = 10;
+    size_t perHole = std::max<size_t>(3, n / 2 / (side * side));
+    addRing(xyz, n - perHole * side * side, 0.0, 0.0, 1.0, 0.0, rng);
+    holes.clear();
+    for (int y = 0; y < side; ++y)
+        for (int x = 0; x < side; ++x) {
+            holes.push_back(uint32_t(xyz.size() / 3));
+            addRing(xyz, perHole, -0.6 + 1.2 * x / (side - 1), -0.6 + 1.2 * y / (side - 1), 0.04, 0.0, rng, true);
+        }
+}
+
+// Área de um anel (sempre positiva)
+double ringArea(const std::vector<float> &xyz, size_t begin, size_t end)
+{
+    double area = 0.0;
+    for (size_t i = begin, j = end - 1; i < end; j = i++)
+        area += double(xyz[j * 3]) * xyz[i * 3 + 1] - double(xyz[i * 3]) * xyz[j * 3 + 1];
+    return fabs(area) * 0.5;
+}
+
+// Confere a saída: até n - 2 + 2 por furo triângulos (menos se houver pontos colineares)
+// cobrindo a área do polígono
+bool checkTriangulation(const std::vector<float> &xyz, const std::vector<uint32_t> &holes,
+                        const std::vector<uint32_t> &indices, double &relativeError)
+{
+    size_t count = xyz.size() / 3;
+    double expected = ringArea(xyz, 0, holes.empty() ? count : holes[0]);
+    for (size_t h = 0; h < holes.size(); ++h)
+        expected -= ringArea(xyz, holes[h], h + 1 < holes.size() ? holes[h + 1] : count);
+    double covered = 0.0;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        const float *a = &xyz[indices[i] * 3], *b = &xyz[indices[i + 1] * 3], *c = &xyz[indices[i + 2] * 3];
+        covered += fabs((double(b[0]) - a[0]) * (double(c[1]) - a[1]) - (double(b[1]) - a[1]) * (double(c[0]) - a[0]));
+    }
+    relativeError = fabs(covered * 0.5 - expected) / expected;
+    return indices.size() / 3 <= count - 2 + 2 * holes.size() && relativeError < 1e-6;
+}
+
+int measure(size_t maxVertices)
+{
+    struct Shape
+    {
+        const char *name;
+        void (*build)(size_t, std::vector<float> &, std::vector<uint32_t> &);
+    };
+    const Shape shapes[] = {{"contorno", outlinePolygon},
+                            {"espiral", spiralPolygon},
+                            {"100 furos", holesPolygon},
+                            {"espinhos", spikesPolygon}};
+    printf("%-10s %9s %12s %12s %12s %12s\n", "polígono", "vértices", "com grade", "vértices/s", "sem grade", "ok");
+    Triangulator triangulator;
+    std::vector<float> xyz;
+    std::vector<uint32_t> holes, indices;
+    bool allOk = true;
+    for (const Shape &shape : shapes)
+        for (size_t n = 1000; n <= maxVertices; n *= 10) {
+            xyz.clear();
+            shape.build(n, xyz, holes);
+            size_t count = xyz.size() / 3;
+            double best = INFINITY, naive = 0.0, error = 0.0;
+            for (int run = 0; run < (n < 1000000 ? 3 : 2); ++run) {
+                auto start = Clock::now();
+                triangulate(triangulator, xyz.data(), count, holes, indices);
+                best = std::min(best, msSince(start));
+            }
+            bool ok = checkTriangulation(xyz, holes, indices, error);
+            if (n <= NAIVE_MAX_VERTICES) {
+                triangulator.useSpatialHash = false;
+                auto start = Clock::now();
+                triangulate(triangulator, xyz.data(), count, holes, indices);
+                naive = msSince(start);
+                triangulator.useSpatialHash = true;
+            }
+            char naiveText[32] = "-";
+            if (naive > 0.0)
+                snprintf(naiveText, sizeof(naiveText), "%.1f ms", naive);
+            printf("%-10s %9zu %9.1f ms %12.2e %12s %12s\n", shape.name, count, best, count / best * 1000.0, naiveText,
+                   ok ? "sim" : "NÃO");
+            if (!ok)
+                printf("  %zu triângulos, erro de área %.2e\n", indices.size() / 3, error);
+            allOk = allOk && ok;
+        }
+    return allOk ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    bool example = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--mede") == 0)
+            return measure(i + 1 < argc ? std::max<size_t>(1000, strtoull(argv[i + 1], nullptr, 10)) : DEFAULT_MAX_VERTICES);
+        if (strcmp(argv[i], "--exemplo") == 0)
+            example = true;
+    }
+
+    if (!glfwInit()) {
+        std::cerr << "Falha ao inicializar GLFW" << std::endl;
+        return -1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Triangulação de polígonos", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Falha ao criar a janela GLFW" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetMouseButtonCallback(window, mouse_button_callback);
+
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Falha ao inicializar GLAD" << std::endl;
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+
+    GLuint shaderProgram = buildShaderProgram(vertexShaderSource, fragmentShaderSource);
+    GLint colorLoc = glGetUniformLocation(shaderProgram, "inputColor");
+    MarkerRenderer markers = createMarkerRenderer();
+    std::vector<Marker> openMarkers;
+
+    GLuint VAO, VBO, EBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBindVertexArray(0);
+
+    // Exemplo: estrela com dois furos, um deles côncavo, em pixels
+    if (example) {
+        std::mt19937 rng(7);
+        addRing(polygon.points, 40, 400.0, 400.0, 350.0, 150.0, rng);
+        closeRing(polygon);
+        addRing(polygon.points, 24, 330.0, 420.0, 60.0, 0.0, rng);
+        closeRing(polygon);
+        addRing(polygon.points, 12, 470.0, 360.0, 60.0, 30.0, rng);
+        closeRing(polygon);
+    }
+
+    while (!glfwWindowShouldClose(window)) {
+        glfwPollEvents();
+
+        if (polygon.dirty) {
+            // O polígono só muda com um clique: reenvia tudo (é pequeno)
+            glBindVertexArray(VAO);
+            glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            glBufferData(GL_ARRAY_BUFFER, polygon.points.size() * sizeof(float), polygon.points.data(), GL_STATIC_DRAW);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, polygon.indices.size() * sizeof(uint32_t), polygon.indices.data(),
+                         GL_STATIC_DRAW);
+            glBindVertexArray(0);
+            openMarkers.clear();
+            for (size_t i = polygon.openStart; i < polygon.points.size() / 3; ++i)
+                openMarkers.push_back(makeMarker(polygon.points[i * 3] / WIDTH * 2.0f - 1.0f,
+                                                 polygon.points[i * 3 + 1] / HEIGHT * 2.0f - 1.0f, 8.0f, MARKER_ROUND,
+                                                 1.0f, 1.0f, 0.0f));
+            markerUpload(markers, openMarkers);
+            polygon.dirty = false;
+        }
+
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glUseProgram(shaderProgram);
+        glBindVertexArray(VAO);
+        // Preenchimento e, por cima, as arestas dos triângulos
+        glUniform4f(colorLoc, 0.2f, 0.45f, 0.8f, 1.0f);
+        glDrawElements(GL_TRIANGLES, GLsizei(polygon.indices.size()), GL_UNSIGNED_INT, 0);
+        glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+        glUniform4f(colorLoc, 0.75f, 0.85f, 1.0f, 1.0f);
+        glDrawElements(GL_TRIANGLES, GLsizei(polygon.indices.size()), GL_UNSIGNED_INT, 0);
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        // Anel ainda aberto
+        GLsizei open = GLsizei(polygon.points.size() / 3 - polygon.openStart);
+        glUniform4f(colorLoc, 1.0f, 1.0f, 0.0f, 1.0f);
+        glDrawArrays(GL_LINE_STRIP, GLint(polygon.openStart), open);
+        glBindVertexArray(0);
+        markerDraw(markers);
+
+        glfwSwapBuffers(window);
+    }
+
+    deleteMarkerRenderer(markers);
+    glDeleteBuffers(1, &VBO);
+    glDeleteBuffers(1, &EBO);
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteProgram(shaderProgram);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Compara um resultado do Benchmark com a referência guardada e aponta as regressões.
+
+Uso: compara.py referencia.json resultado.json [--tolerancia 0.15]
+
+Regressão: p50 ou p95 do tempo de frame acima da referência mais a tolerância, qualquer
+aumento de chamadas de GL por frame, ou memória ocupada pela cena (residente depois dos frames
+menos antes da cena) 20% maior, com 1 MB de folga para o ruído do alocador. Uma métrica
+acompanhada que falte na referência ou no resultado (ex.: referência gravada por uma versão
+antiga do Benchmark) também reprova: regere a referência com `make bench-referencia`. Sai com
+código 1 se houver alguma, para poder ser usado em scripts.
+"""
+import json
+import sys
+
+RSS_TOLERANCE = 0.20
+RSS_SLACK_KB = 1024
+METRICS = ("p50_ms", "p95_ms", "chamadas_gl", "rss_cena_kb")
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return data, {(r["cena"], r["objetos"]): r for r in data["resultados"]}
+
+
+def main(argv):
+    args = [a for a in argv[1:] if not a.startswith("--")]
+    tolerance = 0.15
+    if "--tolerancia" in argv:
+        tolerance = float(argv[argv.index("--tolerancia") + 1])
+        args = [a for a in args if a != argv[argv.index("--tolerancia") + 1]]
+    if len(args) != 2:
+        print(__doc__)
+        return 2
+
+    reference, before = load(args[0])
+    current, after = load(args[1])
+    if reference.get("renderer") != current.get("renderer"):
+        print(f"aviso: renderers diferentes ({reference.get('renderer')} x {current.get('renderer')})")
+
+    regressions = 0
+    print(f"{'cena':<24} {'objetos':>8} {'p50 ref':>10} {'p50':>10} {'dif':>8} {'chamadas':>10}")
+    for key, new in after.items():
+        old = before.get(key)
+        if old is None:
+            print(f"{key[0]:<24} {key[1]:>8} {'-':>10} {new['p50_ms']:>10.3f} {'nova':>8} {new['chamadas_gl']:>10}")
+            continue
+        missing = [f"{field} ausente {where}" for field in METRICS
+                   for where, row in (("na referência", old), ("no resultado", new)) if field not in row]
+        if missing:
+            print(f"{key[0]:<24} {key[1]:>8}  REGRESSÃO: " + "; ".join(missing))
+            regressions += 1
+            continue
+        problems = []
+        for field in ("p50_ms", "p95_ms"):
+            if new[field] > old[field] * (1.0 + tolerance):
+                problems.append(f"{field} {old[field]:.3f} -> {new[field]:.3f}")
+        if new["chamadas_gl"] > old["chamadas_gl"]:
+            problems.append(f"chamadas {old['chamadas_gl']} -> {new['chamadas_gl']}")
+        if new["rss_cena_kb"] > old["rss_cena_kb"] * (1.0 + RSS_TOLERANCE) + RSS_SLACK_KB:
+            problems.append(f"rss da cena {old['rss_cena_kb']} -> {new['rss_cena_kb']} KB")
+        change = (new["p50_ms"] / old["p50_ms"] - 1.0) * 100.0 if old["p50_ms"] > 0 else 0.0
+        mark = "  REGRESSÃO: " + "; ".join(problems) if problems else ""
+        print(f"{key[0]:<24} {key[1]:>8} {old['p50_ms']:>10.3f} {new['p50_ms']:>10.3f} {change:>+7.1f}% "
+              f"{new['chamadas_gl']:>10}{mark}")
+        regressions += bool(problems)
+
+    print(f"\n{regressions} regressões (tolerância de tempo {tolerance * 100:.0f}%)")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
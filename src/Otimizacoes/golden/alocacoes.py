@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Confere que nenhuma atividade aloca memória no laço depois do aquecimento.
+
+Uso: alocacoes.py pasta [--frames 120] [--aquecimento 30] [programa ...]
+
+Roda cada atividade compilada com -DALLOC_TRACK (alloc_tracker.h) que estiver em 'pasta', em
+janela oculta, por --frames frames, de duas formas:
+  captura   as mesmas entradas do golden.py (cliques sintéticos reproduzidos nos exercícios
+            interativos, relógio simulado e thread de desenho no mesmo passo)
+  ao vivo   sem captura nem reprodução (CAPTURE_CLOSE_FRAME só fecha a janela): relógio real,
+            entrada gravada em um arquivo temporário e, no TrianguloComClique, também com
+            --thread-unica
+O programa sai com código 3 quando algum frame depois do aquecimento alocou; nesse caso o
+relatório dele (pontos de chamada) é mostrado. Sai com código 1 se alguma execução falhar.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+
+from golden import PROGRAMS
+
+# Argumentos extras de cada execução ao vivo (uma execução por lista)
+LIVE_ARGS = {"TrianguloComClique": [[], ["--thread-unica"]]}
+
+
+def runs(program):
+    """Execuções de um programa: (rótulo, ao vivo, argumentos)."""
+    result = [("captura", False, [])]
+    for args in LIVE_ARGS.get(program, [[]]):
+        result.append((" ".join(["ao vivo"] + args), True, args))
+    return result
+
+
+def run(folder, program, frames, warmup, live, args):
+    with tempfile.TemporaryDirectory() as tmp:
+        env = dict(os.environ, ALLOC_WARMUP=str(warmup))
+        if live:
+            env["CAPTURE_CLOSE_FRAME"] = str(frames)
+            if "INPUT_SYNTH" in PROGRAMS[program]:
+                env["INPUT_RECORD"] = os.path.join(tmp, "entrada.bin")
+        else:
+            # A captura só serve para fechar a janela no frame escolhido (e deixá-la oculta)
+            env.update(PROGRAMS[program], CAPTURE_PNG=os.path.join(tmp, "quadro.png"),
+                       CAPTURE_FRAME=str(frames))
+            if "INPUT_FRAMES" in env:
+                env["INPUT_FRAMES"] = str(frames + 10)
+        return subprocess.run([os.path.join(folder, program)] + args, env=env, stdout=subprocess.DEVNULL,
+                              stderr=subprocess.PIPE, timeout=300)
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    folder = argv[1]
+    frames, warmup = 120, 30
+    if "--frames" in argv:
+        frames = int(argv[argv.index("--frames") + 1])
+    if "--aquecimento" in argv:
+        warmup = int(argv[argv.index("--aquecimento") + 1])
+    names = [a for a in argv[2:] if a in PROGRAMS] or list(PROGRAMS)
+
+    failures = total = 0
+    for program in names:
+        for label, live, args in runs(program):
+            total += 1
+            name = f"{program} ({label})"
+            try:
+                result = run(folder, program, frames, warmup, live, args)
+            except (OSError, subprocess.TimeoutExpired) as error:
+                print(f"{name:<46} ERRO: {error}")
+                failures += 1
+                continue
+            report = result.stderr.decode(errors="replace")
+            summary = [line for line in report.splitlines() if line.startswith("alocações depois")]
+            if result.returncode == 0 and summary:
+                print(f"{name:<46} ok ({summary[0].split(': ', 1)[1]})")
+                continue
+            failures += 1
+            status = "ALOCOU depois do aquecimento" if result.returncode == 3 else f"código {result.returncode}"
+            print(f"{name:<46} FALHOU: {status}")
+            print("\n".join("    " + line for line in report.splitlines() if line.strip()))
+
+    print(f"\n{total - failures} de {total} execuções sem alocações depois de {warmup} frames "
+          f"(de {frames})")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Prepara as atividades do baseline para gravar as referências do make golden.
+
+Uso (a partir da raiz do repositório):
+    git worktree add /tmp/base b50e691
+    python3 src/Otimizacoes/golden/ganchos_baseline.py /tmp/base/src/Trabalhos*/*/*.cpp
+    compile cada atividade de /tmp/base com -I/tmp/base/include -ICommun em uma pasta e, nela,
+    python3 <repo>/src/Otimizacoes/golden/golden.py --referencia
+
+Só acrescenta os ganchos de captura, sem tocar no desenho: frame_capture.h, captureWindowHints()
+antes do glfwCreateWindow, captureInit() antes do laço e captureEndFrame(window) antes do
+glfwSwapBuffers. Nos exercícios interativos (TrianguloComClique e Exec3) troca também a entrada
+do GLFW pela do input_replay.h, para receberem os mesmos cliques sintéticos, e fixa a semente da
+cor aleatória na captura, como nas versões atuais. Edita os arquivos no lugar.
+"""
+import pathlib
+import re
+import sys
+
+INTERACTIVE = {"TrianguloComClique", "Exec3"}
+RANDOM_SEED = ("static std::mt19937 rng{std::random_device{}()};",
+               "static std::mt19937 rng{captureEnabled() ? 1234u : std::random_device{}()};")
+
+
+def add_hooks(path):
+    name = path.stem
+    interactive = name in INTERACTIVE
+    source = path.read_text()
+    includes = '#include "frame_capture.h"\n' + ('#include "input_replay.h"\n' if interactive else "")
+    source = source.replace("#include <GLFW/glfw3.h>\n", "#include <GLFW/glfw3.h>\n" + includes, 1)
+    if interactive:
+        source = source.replace(*RANDOM_SEED)
+
+    lines = []
+    for line in source.split("\n"):
+        indent = re.match(r"\s*", line).group(0)
+        if "glfwCreateWindow(" in line:
+            lines.append(indent + "captureWindowHints();")
+            if interactive:
+                lines.append(indent + "inputWindowHints();")
+        if re.match(r"\s*while \(!glfwWindowShouldClose\(window\)\)", line):
+            if interactive:
+                lines.append(indent + "inputInit(window);")
+            lines.append(indent + "captureInit();")
+        if line.strip() == "glfwSwapBuffers(window);":
+            lines.append(indent + "captureEndFrame(window);")
+        if interactive:
+            line = line.replace("glfwPollEvents();", "inputPollEvents(window);")
+            line = line.replace("glfwGetCursorPos(", "inputCursorPos(")
+        lines.append(line)
+    path.write_text("\n".join(lines))
+
+
+if __name__ == "__main__":
+    for argument in sys.argv[1:]:
+        add_hooks(pathlib.Path(argument))
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""Testes de imagem de referência: roda cada atividade em janela oculta, captura um frame em PNG
+(frame_capture.h) e compara com a imagem guardada em referencia/.
+
+Uso: golden.py [--referencia] [--limiar 0.1] [--max-diferentes 0.005] [programa ...]
+
+A comparação é perceptual: a diferença de cor de cada pixel é medida no espaço YIQ (como no
+pixelmatch) e o pixel só conta como diferente acima do limiar (0 a 1). O teste falha quando a
+fração de pixels diferentes passa de --max-diferentes; nesse caso grava saida/<programa>_dif.png
+com os pixels diferentes em vermelho. --referencia grava novas referências em vez de comparar.
+Os executáveis são procurados na pasta atual (onde o make os gera). Sai com código 1 se algum
+teste falhar.
+"""
+import os
+import struct
+import subprocess
+import sys
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+REFERENCE_DIR = os.path.join(HERE, "referencia")
+OUTPUT_DIR = os.path.join(HERE, "saida")
+
+# Cliques sintéticos (semente fixa) para os exercícios interativos, capturados antes do fim
+CLICKS = {"INPUT_SYNTH": "cliques:120", "INPUT_FRAMES": "60", "INPUT_HEADLESS": "1", "CAPTURE_FRAME": "45"}
+
+# Programa -> variáveis de ambiente extras
+PROGRAMS = {
+    "PoligonoPreenchido": {},
+    "ApenasComContorno": {},
+    "ApenasComPontos": {},
+    "TresFormas": {},
+    "Octagono": {},
+    "Pentagono": {},
+    "PacMan": {},
+    "FatiaPizza": {},
+    "Estrela": {},
+    "Espiral": {"CAPTURE_FRAME": "240"},  # 4 s simulados de crescimento
+    "DesenhoCuston": {},
+    "Ex01": {},
+    "Ex02": {},
+    "Ex03": {},
+    "ViewportComQuadrante": {},
+    "ViewportCom4Quadrante": {},
+    "TrianguloComClique": CLICKS,
+    "Exec1": {},
+    "Exec2": {},
+    "Exec3": CLICKS,
+}
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    """Devolve (largura, altura, linhas RGB de cima para baixo) de um PNG RGB/RGBA de 8 bits."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path} não é PNG")
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color = struct.unpack(">IIBB", body[:10])
+            if depth != 8 or color not in (2, 6):
+                raise ValueError(f"{path}: só PNG RGB/RGBA de 8 bits")
+            channels = 4 if color == 6 else 3
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, previous = [], bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind, row = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride if kind else 0):
+            left = row[i - channels] if i >= channels else 0
+            up = previous[i]
+            if kind == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif kind == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                upLeft = previous[i - channels] if i >= channels else 0
+                row[i] = (row[i] + paeth(left, up, upLeft)) & 0xFF
+        previous = row
+        if channels == 4:
+            del row[3::4]
+        rows.append(bytes(row))
+    return width, height, rows
+
+
+def write_png(path, width, height, rows):
+    """Grava linhas RGB (de cima para baixo) em PNG."""
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+    raw = b"".join(b"\x00" + row for row in rows)
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw)))
+        f.write(chunk(b"IEND", b""))
+
+
+MAX_DELTA = 35215.0  # maior diferença possível na métrica YIQ abaixo
+
+
+def color_delta(r1, g1, b1, r2, g2, b2):
+    dr, dg, db = r1 - r2, g1 - g2, b1 - b2
+    y = dr * 0.29889531 + dg * 0.58662247 + db * 0.11448223
+    i = dr * 0.59597799 - dg * 0.27417610 - db * 0.32180189
+    q = dr * 0.21147017 - dg * 0.52261711 + db * 0.31114694
+    return 0.5053 * y * y + 0.299 * i * i + 0.1957 * q * q
+
+
+def compare(reference, current, threshold):
+    """Devolve as posições (x, y) dos pixels perceptualmente diferentes."""
+    width, _, before = reference
+    limit = MAX_DELTA * threshold * threshold
+    different = []
+    for y, (old, new) in enumerate(zip(before, current[2])):
+        if old == new:
+            continue
+        for x in range(width):
+            k = x * 3
+            if color_delta(old[k], old[k + 1], old[k + 2], new[k], new[k + 1], new[k + 2]) > limit:
+                different.append((x, y))
+    return different
+
+
+def diff_image(reference, different):
+    """Referência clareada, com os pixels diferentes em vermelho."""
+    rows = [bytearray(200 + v // 5 for v in row) for row in reference[2]]
+    for x, y in different:
+        rows[y][x * 3:x * 3 + 3] = b"\xff\x00\x00"
+    return [bytes(row) for row in rows]
+
+
+def capture(program, path):
+    env = dict(os.environ, CAPTURE_PNG=path, **PROGRAMS[program])
+    if os.path.exists(path):
+        os.remove(path)
+    result = subprocess.run([os.path.join(".", program)], env=env, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE, timeout=120)
+    if result.returncode != 0 or not os.path.exists(path):
+        raise RuntimeError(f"{program} saiu com código {result.returncode}: {result.stderr.decode(errors='replace')}")
+
+
+def main(argv):
+    update = "--referencia" in argv
+    threshold, max_fraction = 0.1, 0.005
+    if "--limiar" in argv:
+        threshold = float(argv[argv.index("--limiar") + 1])
+    if "--max-diferentes" in argv:
+        max_fraction = float(argv[argv.index("--max-diferentes") + 1])
+    names = [a for a in argv[1:] if a in PROGRAMS] or list(PROGRAMS)
+
+    os.makedirs(OUTPUT_DIR, exist_ok=True)
+    os.makedirs(REFERENCE_DIR, exist_ok=True)
+    failures = 0
+    print(f"{'programa':<24} {'tamanho':>9} {'diferentes':>11} {'fração':>8}  resultado")
+    for program in names:
+        reference_path = os.path.join(REFERENCE_DIR, program + ".png")
+        current_path = os.path.join(OUTPUT_DIR, program + ".png")
+        try:
+            capture(program, current_path)
+        except (OSError, RuntimeError, subprocess.TimeoutExpired) as error:
+            print(f"{program:<24} {'':>9} {'':>11} {'':>8}  ERRO: {error}")
+            failures += 1
+            continue
+        if update:
+            # A captura sai sem compressão; a referência guardada é recomprimida com zlib
+            width, height, rows = read_png(current_path)
+            write_png(reference_path, width, height, rows)
+            print(f"{program:<24} {f'{width}x{height}':>9} {'':>11} {'':>8}  referência gravada")
+            continue
+        if not os.path.exists(reference_path):
+            print(f"{program:<24} {'':>9} {'':>11} {'':>8}  sem referência (rode make golden-referencia)")
+            failures += 1
+            continue
+
+        reference, current = read_png(reference_path), read_png(current_path)
+        size = f"{current[0]}x{current[1]}"
+        if reference[:2] != current[:2]:
+            print(f"{program:<24} {size:>9} {'':>11} {'':>8}  FALHOU: referência tem {reference[0]}x{reference[1]}")
+            failures += 1
+            continue
+        different = compare(reference, current, threshold)
+        fraction = len(different) / (current[0] * current[1])
+        status = "ok"
+        if fraction > max_fraction:
+            status = "FALHOU"
+            failures += 1
+            write_png(os.path.join(OUTPUT_DIR, program + "_dif.png"), current[0], current[1],
+                      diff_image(reference, different))
+        print(f"{program:<24} {size:>9} {len(different):>11} {fraction:>7.3%}  {status}")
+
+    if not update:
+        print(f"\n{len(names) - failures} de {len(names)} iguais à referência "
+              f"(limiar {threshold}, até {max_fraction:.2%} de pixels diferentes)")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
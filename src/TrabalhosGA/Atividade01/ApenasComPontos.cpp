@@ -3,34 +3,20 @@
 #include <cassert>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "markers.h"
+#include "frame_capture.h"
 
 using namespace std;
 
 // Constantes
 const GLuint WIDTH = 800, HEIGHT = 600;
 
-// Shaders
-const char *vertexShaderSource = R"(
- #version 400
- layout (location = 0) in vec3 position;
- void main() {
-     gl_Position = vec4(position, 1.0);
- }
-)";
-const char *fragmentShaderSource = R"(
- #version 400
- uniform vec4 inputColor;
- out vec4 color;
- void main() {
-     color = inputColor;
- }
-)";
+// Tamanho dos pontos em pixels
+const float POINT_SIZE = 20.0f;
 
 // Prototipagem
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
-GLuint createShader(GLenum type, const char *source);
-GLuint createShaderProgram();
-GLuint setupGeometry(GLuint &VBO);
+void setupPoints(MarkerRenderer &points);
 
 // Função principal
 int main() {
@@ -42,6 +28,7 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Poligono com pontos!", nullptr, nullptr);
     if (!window) {
         cerr << "Falha ao criar a janela GLFW" << endl;
@@ -64,15 +51,13 @@ int main() {
     glfwGetFramebufferSize(window, &width, &height);
     glViewport(0, 0, width, height);
 
-    GLuint shaderID = createShaderProgram();
-    GLuint VBO, VAO = setupGeometry(VBO);
-    GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
-
-    glUseProgram(shaderID);
+    MarkerRenderer points;
+    setupPoints(points);
 
     double prev_s = glfwGetTime();
     double title_countdown_s = 0.1;
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         double curr_s = glfwGetTime();
         double elapsed_s = curr_s - prev_s;
@@ -90,21 +75,15 @@ int main() {
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glLineWidth(10);
-        glPointSize(20);
-        glBindVertexArray(VAO);
-
-        glUniform4f(colorLoc, 0.6f, 1.0f, 0.6f, 1.0f);
-        glDrawArrays(GL_POINTS, 0, 3);
-
-        glUniform4f(colorLoc, 0.8f, 0.8f, 0.8f, 1.0f);
-        glDrawArrays(GL_POINTS, 3, 3);
+        // Os 6 pontos, com as duas cores, em uma única chamada
+        markerDraw(points);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
+    deleteMarkerRenderer(points);
     glfwTerminate();
     return 0;
 }
@@ -116,54 +95,16 @@ void key_callback(GLFWwindow *window, int key, int, int action, int) {
         glfwSetWindowShouldClose(window, GL_TRUE);
 }
 
-GLuint createShader(GLenum type, const char *source) {
-    GLuint shader = glCreateShader(type);
-    glShaderSource(shader, 1, &source, nullptr);
-    glCompileShader(shader);
-    GLint success;
-    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        char infoLog[512];
-        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-        cerr << "Erro ao compilar shader: " << infoLog << endl;
-    }
-    return shader;
-}
-
-GLuint createShaderProgram() {
-    GLuint vertexShader = createShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLuint fragmentShader = createShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-    GLuint program = glCreateProgram();
-    glAttachShader(program, vertexShader);
-    glAttachShader(program, fragmentShader);
-    glLinkProgram(program);
-    GLint success;
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
-    if (!success) {
-        char infoLog[512];
-        glGetProgramInfoLog(program, 512, nullptr, infoLog);
-        cerr << "Erro ao linkar programa: " << infoLog << endl;
-    }
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-    return program;
-}
-
-GLuint setupGeometry(GLuint &VBO) {
-    GLfloat vertices[] = {
-        -0.8f, -0.5f, 0.0f, -0.2f, -0.5f, 0.0f, -0.5f, 0.5f, 0.0f,
-         0.2f, -0.5f, 0.0f,  0.8f, -0.5f, 0.0f,  0.5f, 0.5f, 0.0f
+// Cada vértice dos dois triângulos vira um marcador quadrado com a cor do seu triângulo
+void setupPoints(MarkerRenderer &points) {
+    Marker vertices[] = {
+        makeMarker(-0.8f, -0.5f, POINT_SIZE, MARKER_SQUARE, 0.6f, 1.0f, 0.6f),
+        makeMarker(-0.2f, -0.5f, POINT_SIZE, MARKER_SQUARE, 0.6f, 1.0f, 0.6f),
+        makeMarker(-0.5f,  0.5f, POINT_SIZE, MARKER_SQUARE, 0.6f, 1.0f, 0.6f),
+        makeMarker( 0.2f, -0.5f, POINT_SIZE, MARKER_SQUARE, 0.8f, 0.8f, 0.8f),
+        makeMarker( 0.8f, -0.5f, POINT_SIZE, MARKER_SQUARE, 0.8f, 0.8f, 0.8f),
+        makeMarker( 0.5f,  0.5f, POINT_SIZE, MARKER_SQUARE, 0.8f, 0.8f, 0.8f)
     };
-    GLuint VAO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GLfloat), (GLvoid *)0);
-    glEnableVertexAttribArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-    return VAO;
-}
\ No newline at end of file
+    points = createMarkerRenderer();
+    markerUpload(points, vertices, 6);
+}
@@ -1,6 +1,10 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <cstdlib>
 #include <iostream>
+#include <unistd.h>
+#include "frame_capture.h"
+#include "scene_file.h"
 
 // Callback para ajustar viewport
 void framebuffer_size_callback(GLFWwindow *window, int width, int height)
@@ -14,6 +18,27 @@ void processInput(GLFWwindow *window)
         glfwSetWindowShouldClose(window, true);
 }
 
+// SCENE_FILE=casa.cena: se o arquivo existe, a casa vem dele (posição e cor em float, como os
+// arrays abaixo); senão a casa dos arrays é desenhada e gravada nele
+bool loadHouse(const char *path, SceneMesh &mesh)
+{
+    SceneFile file;
+    if (access(path, F_OK) != 0 || !sceneOpen(path, file))
+        return false;
+    const SceneChunk *vertices = sceneFind(file, SCENE_VERTICES);
+    bool loaded = vertices && file.header->primitive == GL_TRIANGLES &&
+                  sceneHasLayout(*vertices, 6 * sizeof(float),
+                                 {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, 0),
+                                  sceneAttribute(SCENE_COLOR, 3, GL_FLOAT, 3 * sizeof(float))}) &&
+                  sceneUpload(file, mesh);
+    if (loaded)
+        std::cout << "Casa carregada de " << path << std::endl;
+    else
+        std::cerr << path << ": a cena não tem o layout da casa, usando a casa padrão" << std::endl;
+    sceneClose(file);
+    return loaded;
+}
+
 // Vertex Shader
 const char *vertexShaderSource = R"glsl(
     #version 330 core
@@ -47,6 +72,7 @@ int main()
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(800, 600, "Casa", NULL, NULL);
     if (window == NULL)
     {
@@ -225,25 +251,47 @@ int main()
         15, 16, 17,
         15, 17, 18};
 
-    unsigned int VBO, VAO, EBO;
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
+    // SCENE_FILE=casa.cena carrega a casa do arquivo ou, se ele não existir, grava a casa dos
+    // arrays nele (CenaBinaria casa.cena também desenha)
+    const char *sceneFile = getenv("SCENE_FILE");
+    SceneMesh house;
+    bool houseFromFile = sceneFile && loadHouse(sceneFile, house);
+    if (sceneFile && !houseFromFile && access(sceneFile, F_OK) != 0)
+    {
+        const float bounds[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+        SceneChunkData sceneVertices{sceneChunk(SCENE_VERTICES, sizeof(vertices) / (6 * sizeof(float)), 6 * sizeof(float),
+                                                {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, 0),
+                                                 sceneAttribute(SCENE_COLOR, 3, GL_FLOAT, 3 * sizeof(float))}),
+                                     vertices};
+        SceneChunkData sceneIndices{sceneIndexChunk(sizeof(indices) / sizeof(unsigned int), GL_UNSIGNED_INT), indices};
+        if (sceneSave(sceneFile, GL_TRIANGLES, bounds, {sceneVertices, sceneIndices}))
+            std::cout << "Casa gravada em " << sceneFile << std::endl;
+    }
 
-    glBindVertexArray(VAO);
+    // A casa lida do arquivo já tem VAO próprio; os arrays só vão para a GPU sem ele
+    unsigned int VBO = 0, VAO = 0, EBO = 0;
+    if (!houseFromFile)
+    {
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glBindVertexArray(VAO);
+
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)0);
+        glEnableVertexAttribArray(0);
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *)(3 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    }
 
+    captureInit();
     // Loop principal
     while (!glfwWindowShouldClose(window))
     {
@@ -253,16 +301,26 @@ int main()
         glClear(GL_COLOR_BUFFER_BIT);
 
         glUseProgram(shaderProgram);
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, sizeof(indices) / sizeof(unsigned int), GL_UNSIGNED_INT, 0);
-
+        if (houseFromFile)
+        {
+            sceneDraw(house);
+        }
+        else
+        {
+            glBindVertexArray(VAO);
+            glDrawElements(GL_TRIANGLES, sizeof(indices) / sizeof(unsigned int), GL_UNSIGNED_INT, 0);
+        }
+
+        captureEndFrame(window);
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteBuffers(1, &EBO);
+    deleteSceneMesh(house);
     glDeleteProgram(shaderProgram);
 
     glfwTerminate();
@@ -3,35 +3,24 @@
 #include <cmath>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "polyline.h"
+#include "spiral.h"
+#include "frame_capture.h"
 
 using namespace std;
 
 // Protótipos
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
-int setupShader();
-int setupSpiral();
+Polyline setupSpiral();
+void extendSpiral(Polyline &spiral, int target);
 
 // Dimensões da janela
 const GLuint WIDTH = 800, HEIGHT = 800;
 
-// Código fonte do Vertex Shader
-const GLchar *vertexShaderSource = R"(
- #version 400
- layout (location = 0) in vec3 position;
- void main() {
-     gl_Position = vec4(position.x, position.y, position.z, 1.0);
- }
- )";
-
-// Código fonte do Fragment Shader
-const GLchar *fragmentShaderSource = R"(
- #version 400
- uniform vec4 inputColor;
- out vec4 color;
- void main() {
-     color = inputColor;
- }
- )";
+// Parâmetros para uma espiral aberta (não fecha círculo); a curva em si está no spiral.h
+const int SPIRAL_POINTS = 200;                                  // pontos gerados = pontos desenhados
+const float SPIRAL_POINTS_PER_SECOND = 100.0f;                  // velocidade de crescimento
+const float SPIRAL_LINE_WIDTH = 2.0f;                           // em pixels (polyline.h)
 
 // Callback para tecla ESC
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode)
@@ -40,96 +29,33 @@ void key_callback(GLFWwindow *window, int key, int scancode, int action, int mod
         glfwSetWindowShouldClose(window, GL_TRUE);
 }
 
-// Compila e linka os shaders
-int setupShader()
+// Cria a polilinha da espiral, que cresce conforme novos pontos são anexados
+Polyline setupSpiral()
 {
-    GLint success;
-    GLchar infoLog[512];
-
-    // Vertex Shader
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        cerr << "ERRO::VERTEX_SHADER\n"
-             << infoLog << endl;
-    }
-
-    // Fragment Shader
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success)
-    {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        cerr << "ERRO::FRAGMENT_SHADER\n"
-             << infoLog << endl;
-    }
-
-    // Programa de shader
-    GLuint shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success)
-    {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        cerr << "ERRO::SHADER_PROGRAM\n"
-             << infoLog << endl;
-    }
-
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-
-    return shaderProgram;
+    return createPolyline();
 }
 
-// Cria os pontos da espiral e configura VAO/VBO
-int setupSpiral()
+// Gera os pontos que faltam até 'target' e envia apenas essa cauda para a GPU
+void extendSpiral(Polyline &spiral, int target)
 {
-    // Parâmetros para uma espiral aberta (não fecha círculo)
-    const int N = 400; // menos pontos para menos voltas
-    float a = 0.0f;
-    float max_radius = 90.0f / 400.0f;  // 0.225
-    float b = max_radius / (N * 0.25f); // mais espaçado
-
-    float vertices[N * 3];
-
-    float theta_step = 0.35f; // aumenta o passo angular para abrir mais
-    for (int i = 0; i < N; i++)
+    if (target > SPIRAL_POINTS)
+        target = SPIRAL_POINTS;
+    int first = int(spiral.points);
+    if (target <= first)
+        return;
+
+    float tail[SPIRAL_POINTS * 3];
+    for (int i = first; i < target; i++)
     {
-        float theta = i * theta_step;
-        float r = a + b * theta;
-        if (r > max_radius)
-            r = max_radius;
-        float x = r * cosf(theta);
-        float y = r * sinf(theta);
-
-        vertices[i * 3 + 0] = x;
-        vertices[i * 3 + 1] = y;
-        vertices[i * 3 + 2] = 0.0f;
+        float theta = i * SPIRAL_THETA_STEP;
+        float r = SPIRAL_B * theta;
+        if (r > SPIRAL_MAX_RADIUS)
+            r = SPIRAL_MAX_RADIUS;
+        tail[(i - first) * 3 + 0] = r * cosf(theta);
+        tail[(i - first) * 3 + 1] = r * sinf(theta);
+        tail[(i - first) * 3 + 2] = 0.0f;
     }
-
-    GLuint VBO, VAO;
-    glGenBuffers(1, &VBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
-    glEnableVertexAttribArray(0);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
-    return VAO;
+    polylineAppend(spiral, tail, size_t(target - first));
 }
 
 // MAIN
@@ -143,6 +69,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
     // Criação da janela
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Espiral", nullptr, nullptr);
     if (!window)
     {
@@ -165,29 +92,33 @@ int main()
     glfwGetFramebufferSize(window, &width, &height);
     glViewport(0, 0, width, height);
 
-    // Shader + Geometria
-    GLuint shaderID = setupShader();
-    GLuint VAO = setupSpiral();
-    GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
+    // Shader + Geometria (linha espessa: glLineWidth acima de 1 pixel não vale no core profile)
+    PolylineShader lineShader = createPolylineShader();
+    Polyline spiral = setupSpiral();
+    captureInit();
+    double start_s = captureTime();
 
     // Loop principal
     while (!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
+        // A espiral cresce com o tempo: só os pontos novos são gerados e enviados
+        extendSpiral(spiral, 1 + int((captureTime() - start_s) * SPIRAL_POINTS_PER_SECOND));
+
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glUseProgram(shaderID);
-        glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f); // vermelho
-        glBindVertexArray(VAO);
-        glDrawArrays(GL_LINE_STRIP, 0, 200);
-        glBindVertexArray(0);
+        // Vermelho, em uma única chamada de desenho
+        polylineDraw(lineShader, spiral, SPIRAL_LINE_WIDTH, POLYLINE_ROUND, 1.0f, 0.0f, 0.0f, 1.0f, width, height);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     // Cleanup
-    glDeleteVertexArrays(1, &VAO);
+    deletePolyline(spiral);
+    deletePolylineShader(lineShader);
     glfwTerminate();
     return 0;
 }
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "frame_capture.h"
 
 constexpr GLuint WIDTH = 800, HEIGHT = 800;
 constexpr int STAR_POINTS = 5; // Número de pontas da estrela
@@ -121,6 +122,7 @@ int main() {
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Estrela", nullptr, nullptr);
     if (!window) {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -147,6 +149,7 @@ int main() {
 
     glUseProgram(shaderID);
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
@@ -156,8 +159,10 @@ int main() {
         glUniform4f(colorLoc, 0.2f, 0.8f, 1.0f, 1.0f); // azul claro
         glDrawArrays(GL_TRIANGLE_FAN, 0, STAR_POINTS * 2 + 2);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &VAO);
     glDeleteProgram(shaderID);
@@ -2,12 +2,15 @@
 #include <cmath>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "frame_capture.h"
 
 constexpr GLuint WIDTH = 800, HEIGHT = 800;
-constexpr int PIZZA_SEGMENTS = 50;
 constexpr float PIZZA_RADIUS = 0.5f;
 constexpr float START_ANGLE = 0.0f;
 constexpr float END_ANGLE = 1.0f * 3.1415926f / 3.0f; // 60 graus
+// Segmentos do arco escolhidos pelo raio na tela (0.5 em NDC -> 200 px)
+const int PIZZA_SEGMENTS = lodSegmentsForRadius(PIZZA_RADIUS * WIDTH / 2.0f, LOD_MAX_ERROR_PX, END_ANGLE - START_ANGLE);
 
 void key_callback(GLFWwindow *window, int key, int, int action, int)
 {
@@ -70,7 +73,7 @@ GLuint setupShader()
 
 GLuint setupGeometry()
 {
-    float vertices[(PIZZA_SEGMENTS + 2) * 3];
+    float vertices[(LOD_MAX_SEGMENTS + 2) * 3];
     vertices[0] = 0.0f; vertices[1] = 0.0f; vertices[2] = 0.0f;
     for (int i = 0; i <= PIZZA_SEGMENTS; ++i) {
         float theta = START_ANGLE + (END_ANGLE - START_ANGLE) * float(i) / float(PIZZA_SEGMENTS);
@@ -85,7 +88,7 @@ GLuint setupGeometry()
 
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (PIZZA_SEGMENTS + 2) * 3 * sizeof(float), vertices, GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), nullptr);
     glEnableVertexAttribArray(0);
@@ -110,6 +113,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Fatia pizza", nullptr, nullptr);
     if (!window) {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -135,6 +139,7 @@ int main()
 
     glUseProgram(shaderID);
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
@@ -144,8 +149,10 @@ int main()
         glUniform4f(colorLoc, 0.2f, 0.8f, 1.0f, 1.0f);
         glDrawArrays(GL_TRIANGLE_FAN, 0, PIZZA_SEGMENTS + 2);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &VAO);
     glfwTerminate();
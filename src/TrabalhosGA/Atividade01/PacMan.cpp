@@ -3,11 +3,15 @@
 #include <vector>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "frame_capture.h"
 
 constexpr GLuint WIDTH = 800, HEIGHT = 800;
-constexpr int PACMAN_SEGMENTS = 50;
 constexpr float PACMAN_RADIUS = 0.5f;
 constexpr float PACMAN_MOUTH_ANGLE = 0.2f * 3.1415926f; // ângulo da boca
+// Segmentos do arco escolhidos pelo raio na tela (0.5 em NDC -> 200 px)
+const int PACMAN_SEGMENTS = lodSegmentsForRadius(PACMAN_RADIUS * WIDTH / 2.0f, LOD_MAX_ERROR_PX,
+                                                 2.0f * 3.1415926f - 2.0f * PACMAN_MOUTH_ANGLE);
 
 // Vertex Shader
 const char *vertexShaderSource = R"(
@@ -77,6 +81,7 @@ void generatePacmanVertices(std::vector<float> &vertices) {
     float end_angle = 2.0f * 3.1415926f - PACMAN_MOUTH_ANGLE;
 
     vertices.clear();
+    vertices.reserve(3 * (PACMAN_SEGMENTS + 2)); // centro + arco, sem realocar a cada push_back
     vertices.push_back(cx);
     vertices.push_back(cy);
     vertices.push_back(0.0f);
@@ -126,6 +131,7 @@ int main() {
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Pac-Man", nullptr, nullptr);
     if (!window) {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -152,6 +158,7 @@ int main() {
 
     glUseProgram(shaderID);
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
@@ -162,8 +169,10 @@ int main() {
         glDrawArrays(GL_TRIANGLE_FAN, 0, PACMAN_SEGMENTS + 2);
 
         glBindVertexArray(0);
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &VAO);
     glDeleteProgram(shaderID);
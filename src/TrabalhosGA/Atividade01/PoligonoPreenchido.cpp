@@ -3,6 +3,7 @@
 #include <cassert>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "frame_capture.h"
 
 using namespace std;
 
@@ -42,6 +43,7 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Poligono preenchido!", nullptr, nullptr);
     if (!window) {
         cerr << "Falha ao criar a janela GLFW" << endl;
@@ -73,6 +75,7 @@ int main() {
     double prev_s = glfwGetTime();
     double title_countdown_s = 0.1;
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         double curr_s = glfwGetTime();
         double elapsed_s = curr_s - prev_s;
@@ -90,8 +93,6 @@ int main() {
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glLineWidth(10);
-        glPointSize(20);
         glBindVertexArray(VAO);
 
         glUniform4f(colorLoc, 0.6f, 1.0f, 0.6f, 1.0f);
@@ -100,8 +101,10 @@ int main() {
         glUniform4f(colorLoc, 0.8f, 0.8f, 0.8f, 1.0f);
         glDrawArrays(GL_TRIANGLES, 3, 3);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
@@ -3,6 +3,8 @@
 #include <cassert>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "markers.h"
+#include "frame_capture.h"
 
 using namespace std;
 
@@ -39,6 +41,7 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Dois triângulos e pontos!", nullptr, nullptr);
     if (!window) {
         cerr << "Falha ao criar a janela GLFW" << endl;
@@ -66,11 +69,23 @@ int main() {
     setupGeometry(VAO, VBO);
 
     GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
-    glUseProgram(shaderID);
+
+    // Pontos nos vértices dos triângulos - branco, 12 px
+    Marker vertexMarkers[] = {
+        makeMarker(-0.8f, -0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f),
+        makeMarker(-0.2f, -0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f),
+        makeMarker(-0.5f,  0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f),
+        makeMarker( 0.2f, -0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f),
+        makeMarker( 0.8f, -0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f),
+        makeMarker( 0.5f,  0.5f, 12.0f, MARKER_SQUARE, 1.0f, 1.0f, 1.0f)
+    };
+    MarkerRenderer markers = createMarkerRenderer();
+    markerUpload(markers, vertexMarkers, 6);
 
     double prev_s = glfwGetTime();
     double title_countdown_s = 0.1;
 
+    captureInit();
     while (!glfwWindowShouldClose(window)) {
         double curr_s = glfwGetTime();
         double elapsed_s = curr_s - prev_s;
@@ -88,8 +103,7 @@ int main() {
         glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glLineWidth(10);
-        glPointSize(20);
+        glUseProgram(shaderID);
         glBindVertexArray(VAO);
 
         // Triângulo 1 preenchido - verde claro
@@ -101,13 +115,14 @@ int main() {
         glDrawArrays(GL_TRIANGLES, 3, 3);
 
         // Pontos nos vértices dos triângulos - branco
-        glPointSize(12);
-        glUniform4f(colorLoc, 1.0f, 1.0f, 1.0f, 1.0f);
-        glDrawArrays(GL_POINTS, 0, 6);
+        markerDraw(markers);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
+    deleteMarkerRenderer(markers);
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glfwTerminate();
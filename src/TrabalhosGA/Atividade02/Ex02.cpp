@@ -2,6 +2,8 @@
 #include <cmath>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "frame_capture.h"
 
 using namespace std;
 
@@ -14,7 +16,8 @@ int setupGeometry();
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 800, HEIGHT = 800;
-const int CIRCLE_SEGMENTS = 100;
+// Segmentos escolhidos pelo raio na tela (r = 0.5 em NDC -> 200 px numa janela de 800)
+const int CIRCLE_SEGMENTS = lodSegmentsForRadius(0.5f * WIDTH / 2.0f);
 
 // Código fonte do Vertex Shader (em GLSL): ainda hardcoded
 const GLchar *vertexShaderSource = R"(
@@ -101,7 +104,7 @@ int setupGeometry()
     // sequencial, já visando mandar para o VBO (Vertex Buffer Objects)
     // O círculo é desenhado usando a equação paramétrica: x = cx + r*cos(theta), y = cy + r*sin(theta)
     float cx = 0.0f, cy = 0.0f, r = 0.5f;
-    float vertices[(CIRCLE_SEGMENTS + 2) * 3];
+    float vertices[(LOD_MAX_SEGMENTS + 2) * 3];
     // Primeiro vértice é o centro (para TRIANGLE_FAN)
     vertices[0] = cx;
     vertices[1] = cy;
@@ -122,7 +125,7 @@ int setupGeometry()
     // Faz a conexão (vincula) do buffer como um buffer de array
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     // Envia os dados do array de floats para o buffer da OpenGl
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (CIRCLE_SEGMENTS + 2) * 3 * sizeof(float), vertices, GL_STATIC_DRAW);
 
     // Geração do identificador do VAO (Vertex Array Object)
     glGenVertexArrays(1, &VAO);
@@ -161,6 +164,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     // Criação da janela GLFW
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Circulo", nullptr, nullptr);
     if (!window)
@@ -199,6 +203,7 @@ int main()
 
     glUseProgram(shaderID); // Reseta o estado do shader para evitar problemas futuros
 
+    captureInit();
     // Loop da aplicação - "game loop"
     while (!glfwWindowShouldClose(window))
     {
@@ -215,8 +220,10 @@ int main()
         glDrawArrays(GL_TRIANGLE_FAN, 0, CIRCLE_SEGMENTS + 2);
 
         // Troca os buffers da tela
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
     // Pede pra OpenGL desalocar os buffers
     glDeleteVertexArrays(1, &VAO);
     // Finaliza a execução da GLFW, limpando os recursos alocados por ela
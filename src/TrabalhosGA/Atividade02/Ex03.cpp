@@ -2,9 +2,12 @@
 #include <cmath>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "frame_capture.h"
 
 const GLuint WIDTH = 800, HEIGHT = 800;
-const int CIRCLE_SEGMENTS = 100;
+// Segmentos escolhidos pelo raio na tela (r = 100 px com u_width = 800 numa janela de 800)
+const int CIRCLE_SEGMENTS = lodSegmentsForRadius(100.0f);
 
 // Vertex Shader
 const GLchar *vertexShaderSource = R"(
@@ -84,7 +87,7 @@ GLuint setupShader()
 void createCircleVAO(GLuint &VAO, GLuint &VBO)
 {
     float cx = 400.0f, cy = 400.0f, r = 100.0f;
-    float vertices[(CIRCLE_SEGMENTS + 2) * 3];
+    float vertices[(LOD_MAX_SEGMENTS + 2) * 3];
     vertices[0] = cx;
     vertices[1] = cy;
     vertices[2] = 0.0f;
@@ -102,7 +105,7 @@ void createCircleVAO(GLuint &VAO, GLuint &VBO)
     glGenBuffers(1, &VBO);
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (CIRCLE_SEGMENTS + 2) * 3 * sizeof(float), vertices, GL_STATIC_DRAW);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
     glEnableVertexAttribArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -136,6 +139,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Circulo", nullptr, nullptr);
     if (!window)
     {
@@ -171,6 +175,7 @@ int main()
     glUniform1f(widthLoc, 800.0f);
     glUniform1f(heightLoc, 800.0f);
 
+    captureInit();
     while (!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
@@ -188,8 +193,10 @@ int main()
         glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 
         glBindVertexArray(0);
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     // Libera recursos
     glDeleteVertexArrays(1, &circleVAO);
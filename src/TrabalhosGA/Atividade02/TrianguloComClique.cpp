@@ -1,9 +1,19 @@
-
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <random>
+#include <cstddef>
+#include <cstring>
+#include <unistd.h>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "markers.h"
+#include "gl_trace.h"
+#include "profiler.h"
+#include "input_replay.h"
+#include "frame_capture.h"
+#include "render_thread.h"
+#include "scene_file.h"
 
 using namespace std;
 
@@ -27,11 +37,14 @@ struct Triangle
 vector<Vertex> currentVertices;
 // Vetor para armazenar todos os triângulos já criados
 vector<Triangle> triangles;
+// Reservados no início: o laço não aloca memória (make alocacoes) até passar disso
+const size_t RESERVED_TRIANGLES = 100000;
+const size_t MAX_LATENCY_SAMPLES = 1 << 16;
 
-// Gera uma cor aleatória (RGBA) para cada triângulo
+// Gera uma cor aleatória (RGBA) para cada triângulo (semente fixa na captura de imagem)
 void randomColor(float color[4])
 {
-    static std::mt19937 rng{std::random_device{}()};
+    static std::mt19937 rng{captureEnabled() ? 1234u : std::random_device{}()};
     static std::uniform_real_distribution<float> dist(0.2f, 1.0f);
     color[0] = dist(rng);
     color[1] = dist(rng);
@@ -39,30 +52,119 @@ void randomColor(float color[4])
     color[3] = 1.0f;
 }
 
-// Callback de clique do mouse: adiciona vértices e cria triângulo a cada 3 cliques
+// --- Cena em arquivo (SCENE_FILE=arquivo.cena): carregada no início, se existir, e gravada ao sair ---
+// Cada triângulo vira 3 vértices com posição em pixels e a cor do triângulo
+struct SceneVertex
+{
+    Vertex position;
+    float color[4];
+};
+
+void loadScene(const char *path)
+{
+    SceneFile file;
+    if (access(path, F_OK) != 0 || !sceneOpen(path, file))
+        return;
+    const SceneChunk *chunk = sceneFind(file, SCENE_VERTICES);
+    if (chunk && sceneHasLayout(*chunk, sizeof(SceneVertex),
+                                {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, offsetof(SceneVertex, position)),
+                                 sceneAttribute(SCENE_COLOR, 4, GL_FLOAT, offsetof(SceneVertex, color))}))
+    {
+        const SceneVertex *v = sceneChunkData<SceneVertex>(file, *chunk);
+        size_t count = chunk->count / 3;
+        triangles.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int k = 0; k < 3; ++k)
+                triangles[i].v[k] = v[i * 3 + k].position;
+            memcpy(triangles[i].color, v[i * 3].color, sizeof(triangles[i].color));
+        }
+        printf("%s: %zu triângulos carregados\n", path, triangles.size());
+    }
+    else
+    {
+        fprintf(stderr, "%s: a cena não tem os triângulos deste exercício\n", path);
+    }
+    sceneClose(file);
+}
+
+void saveScene(const char *path)
+{
+    vector<SceneVertex> vertices(triangles.size() * 3);
+    for (size_t i = 0; i < triangles.size(); ++i)
+        for (int k = 0; k < 3; ++k)
+        {
+            vertices[i * 3 + k].position = triangles[i].v[k];
+            memcpy(vertices[i * 3 + k].color, triangles[i].color, sizeof(triangles[i].color));
+        }
+    const float bounds[4] = {0.0f, 0.0f, float(WIDTH), float(HEIGHT)};
+    SceneChunkData chunk{sceneChunk(SCENE_VERTICES, uint32_t(vertices.size()), sizeof(SceneVertex),
+                                    {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, offsetof(SceneVertex, position)),
+                                     sceneAttribute(SCENE_COLOR, 4, GL_FLOAT, offsetof(SceneVertex, color))}),
+                         vertices.data()};
+    if (sceneSave(path, GL_TRIANGLES, bounds, {chunk}))
+        printf("%s: %zu triângulos gravados\n", path, triangles.size());
+}
+
+// --- Comunicação entre a thread de eventos e a thread de desenho ---
+// Clique recebido na thread de eventos, com o instante para medir a latência até a tela
+struct ClickCommand
+{
+    float x, y;
+    double time;
+};
+
+// Estatísticas publicadas pela thread de desenho para o título da janela
+struct FrameStats
+{
+    double frameMs = 0.0;
+    size_t triangles = 0;
+    double lastLatencyMs = 0.0;
+};
+
+// Tamanho do framebuffer, lido na thread principal (o GLFW não deixa ler na de desenho)
+struct FramebufferSize
+{
+    int width = 0, height = 0;
+};
+
+SpscQueue<ClickCommand, 1 << 16> clickQueue;
+SnapshotBuffer<FrameStats> frameStats;
+SnapshotBuffer<FramebufferSize> framebufferSize;
+size_t droppedClicks = 0;
+
+// Callback de clique do mouse (thread de eventos): o clique só entra na fila; os vértices e o
+// triângulo a cada 3 cliques são montados na thread de desenho
 void mouse_button_callback(GLFWwindow *window, int button, int action, int mods)
 {
+    PROF_ZONE("clique");
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS)
     {
         double xpos, ypos;
-        glfwGetCursorPos(window, &xpos, &ypos);
+        inputCursorPos(window, &xpos, &ypos);
         // Inverter y para coordenada de tela (origem no canto inferior esquerdo)
         ypos = HEIGHT - ypos;
-        // Adiciona o vértice clicado
-        currentVertices.push_back({(float)xpos, (float)ypos, 0.0f});
-        // Se já temos 3 vértices, cria um triângulo
-        if (currentVertices.size() == 3)
-        {
-            Triangle t;
-            for (int i = 0; i < 3; ++i)
-                t.v[i] = currentVertices[i];
-            randomColor(t.color);
-            triangles.push_back(t);
-            currentVertices.clear();
-        }
+        if (!clickQueue.push({(float)xpos, (float)ypos, glfwGetTime()}))
+            droppedClicks++;
     }
 }
 
+// Callback de teclado: ESC fecha, P grava o perfil (PROF_TRACE) sem sair
+void key_callback(GLFWwindow *window, int key, int, int action, int)
+{
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_P && action == GLFW_PRESS)
+        profWriteChromeTrace();
+}
+
+// Na thread principal: publica o tamanho novo para a thread de desenho
+void framebuffer_size_callback(GLFWwindow *, int width, int height)
+{
+    framebufferSize.writeSlot() = {width, height};
+    framebufferSize.publish();
+}
+
 // Vertex Shader: converte coordenadas de pixel para NDC
 const GLchar *vertexShaderSource = R"(
 #version 400
@@ -124,14 +226,224 @@ GLuint setupShader()
     return shaderProgram;
 }
 
-int main()
+// --- Estado da thread de desenho (dona do contexto GL) ---
+struct Renderer
+{
+    GLuint shaderID = 0;
+    GLint colorLoc = -1;
+    // Marcadores dos vértices clicados
+    MarkerRenderer markers;
+    vector<Marker> pendingMarkers;
+    // Cena de fundo opcional (--fundo N): N triângulos pequenos em um único VBO
+    GLuint backgroundVAO = 0, backgroundVBO = 0;
+    int backgroundTriangles = 0;
+    // Triângulos clicados em um único VBO: só os novos são enviados, cabem 'triangleCapacity'
+    GLuint trianglesVAO = 0, trianglesVBO = 0;
+    size_t triangleCapacity = 0, uploadedTriangles = 0;
+    vector<double> frameClicks; // instantes dos cliques aplicados neste frame
+    vector<float> latencyMs;    // clique -> fim do glfwSwapBuffers (só as primeiras amostras)
+    double lastSwap = 0.0;
+};
+
+void createRenderer(Renderer &r, int backgroundTriangles)
+{
+    // Compila e ativa o shader
+    r.shaderID = setupShader();
+    r.colorLoc = glGetUniformLocation(r.shaderID, "inputColor");
+    r.markers = createMarkerRenderer();
+    triangles.reserve(RESERVED_TRIANGLES);
+    currentVertices.reserve(3);
+    r.pendingMarkers.reserve(3);
+    r.frameClicks.reserve(decltype(clickQueue)::capacity);
+    r.latencyMs.reserve(MAX_LATENCY_SAMPLES);
+    r.backgroundTriangles = backgroundTriangles;
+    if (backgroundTriangles > 0)
+    {
+        std::mt19937 rng{42};
+        std::uniform_real_distribution<float> px(0.0f, float(WIDTH)), py(0.0f, float(HEIGHT)), d(-2.0f, 2.0f);
+        vector<Vertex> vertices(size_t(backgroundTriangles) * 3);
+        for (int i = 0; i < backgroundTriangles; ++i)
+        {
+            float x = px(rng), y = py(rng);
+            for (int k = 0; k < 3; ++k)
+                vertices[size_t(i) * 3 + k] = {x + d(rng), y + d(rng), 0.0f};
+        }
+        glGenVertexArrays(1, &r.backgroundVAO);
+        glGenBuffers(1, &r.backgroundVBO);
+        glBindVertexArray(r.backgroundVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, r.backgroundVBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+    }
+    glGenVertexArrays(1, &r.trianglesVAO);
+    glGenBuffers(1, &r.trianglesVBO);
+    glBindVertexArray(r.trianglesVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, r.trianglesVBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+    r.lastSwap = glfwGetTime();
+}
+
+void deleteRenderer(Renderer &r)
 {
+    deleteMarkerRenderer(r.markers);
+    glDeleteBuffers(1, &r.backgroundVBO);
+    glDeleteVertexArrays(1, &r.backgroundVAO);
+    glDeleteBuffers(1, &r.trianglesVBO);
+    glDeleteVertexArrays(1, &r.trianglesVAO);
+    glDeleteProgram(r.shaderID);
+}
+
+// Aplica os cliques da fila: adiciona vértices e cria triângulo a cada 3 cliques
+void applyClicks(Renderer &r)
+{
+    PROF_ZONE("cliques da fila");
+    ClickCommand click;
+    while (clickQueue.pop(click))
+    {
+        r.frameClicks.push_back(click.time);
+        // Adiciona o vértice clicado
+        currentVertices.push_back({click.x, click.y, 0.0f});
+        // Se já temos 3 vértices, cria um triângulo
+        if (currentVertices.size() == 3)
+        {
+            Triangle t;
+            for (int i = 0; i < 3; ++i)
+                t.v[i] = currentVertices[i];
+            randomColor(t.color);
+            // Depois da reserva o vetor dobra de vez em quando: alocação prevista
+            AllocTrackExpected growth(triangles.size() == triangles.capacity());
+            triangles.push_back(t);
+            currentVertices.clear();
+        }
+    }
+}
+
+// Envia os triângulos criados desde o último frame; se passaram da capacidade do VBO, ele é
+// recriado com a capacidade do vetor e recebe todos de novo
+void uploadTriangles(Renderer &r)
+{
+    if (r.uploadedTriangles == triangles.size())
+        return;
+    PROF_ZONE("envio dos triângulos");
+    glBindBuffer(GL_ARRAY_BUFFER, r.trianglesVBO);
+    if (triangles.size() > r.triangleCapacity)
+    {
+        r.triangleCapacity = triangles.capacity();
+        glBufferData(GL_ARRAY_BUFFER, r.triangleCapacity * sizeof(Triangle::v), nullptr, GL_DYNAMIC_DRAW);
+        r.uploadedTriangles = 0;
+    }
+    for (size_t i = r.uploadedTriangles; i < triangles.size(); ++i)
+        glBufferSubData(GL_ARRAY_BUFFER, i * sizeof(Triangle::v), sizeof(Triangle::v), triangles[i].v);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    r.uploadedTriangles = triangles.size();
+}
+
+// Um frame completo, na thread dona do contexto
+void drawFrame(Renderer &r, GLFWwindow *window)
+{
+    applyClicks(r);
+    profGpuBegin("desenho do frame");
+    // Limpa a tela
+    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(r.shaderID);
+    if (r.backgroundTriangles > 0)
+    {
+        PROF_ZONE("cena de fundo");
+        glUniform4f(r.colorLoc, 0.25f, 0.25f, 0.3f, 1.0f);
+        glBindVertexArray(r.backgroundVAO);
+        glDrawArrays(GL_TRIANGLES, 0, r.backgroundTriangles * 3);
+        glBindVertexArray(0);
+    }
+    // Desenha todos os triângulos já criados, cada um com a sua cor, do mesmo VBO
+    uploadTriangles(r);
+    {
+        PROF_ZONE("desenho dos triângulos");
+        glBindVertexArray(r.trianglesVAO);
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            glUniform4fv(r.colorLoc, 1, triangles[i].color); // cor única do triângulo
+            glDrawArrays(GL_TRIANGLES, GLint(i * 3), 3);
+        }
+        glBindVertexArray(0);
+    }
+    // Desenha os vértices atuais (ainda não formam triângulo) como marcadores amarelos de 8 px
+    {
+        PROF_ZONE("marcadores");
+        r.pendingMarkers.clear();
+        for (const auto &v : currentVertices)
+            r.pendingMarkers.push_back(makeMarker(v.x / WIDTH * 2.0f - 1.0f, v.y / HEIGHT * 2.0f - 1.0f, 8.0f,
+                                                  MARKER_ROUND, 1.0f, 1.0f, 0.0f));
+        markerUpload(r.markers, r.pendingMarkers);
+        markerDraw(r.markers);
+    }
+    profGpuEnd();
+    glTraceEndFrame();
+    profEndFrame();
+    // Troca os buffers da tela
+    {
+        PROF_ZONE("troca de buffers");
+        const FramebufferSize &size = framebufferSize.read();
+        captureEndFrame(window, size.width, size.height);
+        glfwSwapBuffers(window);
+    }
+
+    double now = glfwGetTime();
+    for (double time : r.frameClicks)
+        if (r.latencyMs.size() < MAX_LATENCY_SAMPLES)
+            r.latencyMs.push_back(float(1000.0 * (now - time)));
+    FrameStats &stats = frameStats.writeSlot();
+    stats.frameMs = 1000.0 * (now - r.lastSwap);
+    stats.triangles = triangles.size();
+    if (!r.frameClicks.empty())
+        stats.lastLatencyMs = float(1000.0 * (now - r.frameClicks.back()));
+    frameStats.publish();
+    r.frameClicks.clear();
+    r.lastSwap = now;
+}
+
+// Média e percentis de tempos em ms
+void printDistribution(const char *label, const vector<float> &values)
+{
+    if (values.empty())
+        return;
+    vector<float> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (float ms : sorted)
+        total += ms;
+    printf("%s: %zu, média %.2f ms, p50 %.2f ms, p95 %.2f ms, p99 %.2f ms, máx %.2f ms\n", label, sorted.size(),
+           total / sorted.size(), inputPercentile(sorted, 0.50f), inputPercentile(sorted, 0.95f),
+           inputPercentile(sorted, 0.99f), sorted.back());
+}
+
+// Uso: TrianguloComClique [--fundo N] [--thread-unica]
+//   --fundo N        desenha também N triângulos fixos (para simular uma cena pesada)
+//   --thread-unica   eventos e desenho na mesma thread, como antes, para comparar a latência
+int main(int argc, char **argv)
+{
+    int backgroundTriangles = 0;
+    bool singleThread = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--fundo") == 0 && i + 1 < argc)
+            backgroundTriangles = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--thread-unica") == 0)
+            singleThread = true;
+    }
+
     // Inicialização da GLFW e criação da janela
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    captureWindowHints();
+    inputWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Triângulos com Clique", nullptr, nullptr);
     if (!window)
     {
@@ -145,59 +457,102 @@ int main()
         cerr << "Falha ao inicializar GLAD" << endl;
         return -1;
     }
+    // GL_TRACE=1 mostra as chamadas de GL por frame ao sair (GL_TRACE_FILE grava o rastro)
+    glTraceInitFromEnv();
+    // PROF_TRACE=perfil.json grava a linha do tempo de CPU e GPU ao sair (P grava na hora)
+    profInit();
+    glfwSetKeyCallback(window, key_callback);
     // Registra o callback de clique do mouse
     glfwSetMouseButtonCallback(window, mouse_button_callback);
-    // Compila e ativa o shader
-    GLuint shaderID = setupShader();
-    GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
-    glUseProgram(shaderID);
+    // O tamanho do framebuffer chega à thread de desenho pelo snapshot
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    {
+        int width, height;
+        glfwGetFramebufferSize(window, &width, &height);
+        framebuffer_size_callback(window, width, height);
+    }
+    // INPUT_RECORD grava os cliques; INPUT_REPLAY/INPUT_SYNTH reproduzem e medem os frames
+    inputInit(window);
+    captureInit();
+    // Carregada antes de a thread de desenho começar; gravada depois de ela parar
+    const char *sceneFile = getenv("SCENE_FILE");
+    if (sceneFile)
+        loadScene(sceneFile);
+
+    // A thread principal fica só com os eventos; o contexto GL passa para a thread de desenho.
+    // Na reprodução de entrada e na captura as duas andam no mesmo passo (resultado repetível).
+    Renderer renderer;
+    RenderThread render;
+    render.lockstep = inputState.mode == INPUT_REPLAYING || captureEnabled();
+    if (singleThread)
+    {
+        createRenderer(renderer, backgroundTriangles);
+    }
+    else
+    {
+        glfwMakeContextCurrent(nullptr);
+        renderThreadStart(render, window, [&](GLFWwindow *w) {
+            createRenderer(renderer, backgroundTriangles);
+            while (renderThreadNextFrame(render))
+            {
+                drawFrame(renderer, w);
+                renderThreadFrameDone(render);
+            }
+            deleteRenderer(renderer);
+        });
+    }
+
+    double title_countdown_s = 0.1, prev_s = glfwGetTime();
     while (!glfwWindowShouldClose(window))
     {
-        glfwPollEvents();
-        // Limpa a tela
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-        // Desenha todos os triângulos já criados
-        for (const auto &t : triangles)
         {
-            GLuint VAO, VBO;
-            glGenVertexArrays(1, &VAO);
-            glGenBuffers(1, &VBO);
-            glBindVertexArray(VAO);
-            glBindBuffer(GL_ARRAY_BUFFER, VBO);
-            glBufferData(GL_ARRAY_BUFFER, sizeof(t.v), t.v, GL_STATIC_DRAW);
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
-            glEnableVertexAttribArray(0);
-            glUniform4fv(colorLoc, 1, t.color); // cor única do triângulo
-            glDrawArrays(GL_TRIANGLES, 0, 3);
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
-            glBindVertexArray(0);
-            glDeleteBuffers(1, &VBO);
-            glDeleteVertexArrays(1, &VAO);
+            PROF_ZONE("eventos");
+            // Com a thread de desenho livre, espera os eventos a ~1 kHz sem ocupar a CPU
+            bool waitEvents = !singleThread && !render.lockstep;
+            inputPollEvents(window, waitEvents ? 0.001 : 0.0);
         }
-        // Desenha os pontos dos vértices atuais (ainda não formam triângulo)
-        if (!currentVertices.empty())
+        if (singleThread)
+            drawFrame(renderer, window);
+        else
+            renderThreadStep(render); // só no modo sincronizado
+
+        double curr_s = glfwGetTime();
+        title_countdown_s -= curr_s - prev_s;
+        prev_s = curr_s;
+        if (title_countdown_s <= 0.0)
         {
-            GLuint VAO, VBO;
-            glGenVertexArrays(1, &VAO);
-            glGenBuffers(1, &VBO);
-            glBindVertexArray(VAO);
-            glBindBuffer(GL_ARRAY_BUFFER, VBO);
-            glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * currentVertices.size(), currentVertices.data(), GL_STATIC_DRAW);
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
-            glEnableVertexAttribArray(0);
-            glUniform4f(colorLoc, 1.0f, 1.0f, 0.0f, 1.0f); // amarelo
-            glPointSize(8.0f);
-            glDrawArrays(GL_POINTS, 0, currentVertices.size());
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
-            glBindVertexArray(0);
-            glDeleteBuffers(1, &VBO);
-            glDeleteVertexArrays(1, &VAO);
+            const FrameStats &stats = frameStats.read();
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Triângulos com Clique \tFPS %.2lf \t%zu triângulos \tclique->tela %.1f ms%s",
+                     stats.frameMs > 0.0 ? 1000.0 / stats.frameMs : 0.0, stats.triangles, stats.lastLatencyMs,
+                     singleThread ? " (thread única)" : "");
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
         }
-        // Troca os buffers da tela
-        glfwSwapBuffers(window);
     }
+    // O laço acabou: desmontar, gravar a cena e imprimir as distribuições não contam (make alocacoes)
+    allocTrackStop();
+    if (singleThread)
+        deleteRenderer(renderer);
+    else
+    {
+        renderThreadStop(render);
+        // O contexto volta para a thread principal: o profShutdown lê e apaga as queries da GPU
+        glfwMakeContextCurrent(window);
+    }
+    if (sceneFile)
+        saveScene(sceneFile);
+
+    printDistribution("latência clique->tela (cliques)", renderer.latencyMs);
+    if (droppedClicks > 0)
+        printf("%zu cliques descartados (fila cheia)\n", droppedClicks);
+    // Na reprodução o inputShutdown já mostra os tempos do laço de eventos
+    if (inputState.mode != INPUT_REPLAYING)
+        printDistribution("laço de eventos (voltas)", inputState.frameMs);
+    inputShutdown();
+    glTraceShutdown();
+    profShutdown();
     // Finaliza GLFW
     glfwTerminate();
     return 0;
-}
\ No newline at end of file
+}
@@ -1,11 +1,17 @@
 #include <iostream>
 #include <cmath>
+#include <cstdio>
+#include <vector>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "gl_state.h"
+#include "frame_capture.h"
 
 constexpr GLuint WIDTH = 800, HEIGHT = 600;
-constexpr int CIRCLE_SEGMENTS = 100;
 constexpr float CX = 400.0f, CY = 300.0f, R = 100.0f;
+// O círculo é desenhado em um quadrante (metade da janela), logo ocupa R / 2 pixels na tela
+const int CIRCLE_SEGMENTS = lodSegmentsForRadius(R / 2.0f);
 
 // Vertex Shader
 const GLchar *vertexShaderSource = R"(
@@ -34,6 +40,9 @@ void key_callback(GLFWwindow *window, int key, int, int action, int)
 {
     if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
         glfwSetWindowShouldClose(window, GL_TRUE);
+    // C liga/desliga o cache de estado, para comparar as chamadas no título
+    if (key == GLFW_KEY_C && action == GLFW_PRESS)
+        glState.enabled = !glState.enabled;
 }
 
 GLuint setupShader()
@@ -75,7 +84,7 @@ GLuint setupShader()
 
 GLuint setupCircleVAO()
 {
-    float vertices[(CIRCLE_SEGMENTS + 2) * 3];
+    float vertices[(LOD_MAX_SEGMENTS + 2) * 3];
     vertices[0] = CX;
     vertices[1] = CY;
     vertices[2] = 0.0f;
@@ -90,7 +99,7 @@ GLuint setupCircleVAO()
     glGenBuffers(1, &VBO);
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (CIRCLE_SEGMENTS + 2) * 3 * sizeof(float), vertices, GL_STATIC_DRAW);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
     glEnableVertexAttribArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -99,9 +108,8 @@ GLuint setupCircleVAO()
     return VAO;
 }
 
-// Função para desenhar linhas pontilhadas
-void drawDashedLine(GLuint shaderID, GLint colorLoc, GLint widthLoc, GLint heightLoc,
-                    float x1, float y1, float x2, float y2, float dash, float gap)
+// Acrescenta os traços de uma linha pontilhada (pares de pontos para GL_LINES)
+void appendDashedLine(std::vector<float> &vertices, float x1, float y1, float x2, float y2, float dash, float gap)
 {
     float dx = x2 - x1, dy = y2 - y1;
     float length = std::sqrt(dx * dx + dy * dy);
@@ -109,41 +117,56 @@ void drawDashedLine(GLuint shaderID, GLint colorLoc, GLint widthLoc, GLint heigh
     for (float d = 0; d < length; d += dash + gap) {
         float segStart = d;
         float segEnd = std::min(d + dash, length);
-        float sx = x1 + vx * segStart, sy = y1 + vy * segStart;
-        float ex = x1 + vx * segEnd, ey = y1 + vy * segEnd;
-        float line[] = {sx, sy, 0.0f, ex, ey, 0.0f};
-        GLuint vao, vbo;
-        glGenVertexArrays(1, &vao);
-        glGenBuffers(1, &vbo);
-        glBindVertexArray(vao);
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(line), line, GL_STATIC_DRAW);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
-        glEnableVertexAttribArray(0);
-        glUseProgram(shaderID);
-        glUniform4f(colorLoc, 0.5f, 0.5f, 0.5f, 1.0f);
-        glUniform1f(widthLoc, WIDTH);
-        glUniform1f(heightLoc, HEIGHT);
-        glDrawArrays(GL_LINES, 0, 2);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
-        glDeleteBuffers(1, &vbo);
-        glDeleteVertexArrays(1, &vao);
+        vertices.insert(vertices.end(), {x1 + vx * segStart, y1 + vy * segStart, 0.0f,
+                                         x1 + vx * segEnd, y1 + vy * segEnd, 0.0f});
     }
 }
 
+// Linhas pontilhadas dos quadrantes: todos os traços em um VBO só, criado uma vez
+GLuint setupDashedLinesVAO(float dash, float gap, GLsizei &vertexCount)
+{
+    std::vector<float> vertices;
+    appendDashedLine(vertices, WIDTH / 2, 0, WIDTH / 2, HEIGHT, dash, gap); // vertical
+    appendDashedLine(vertices, 0, HEIGHT / 2, WIDTH, HEIGHT / 2, dash, gap); // horizontal
+    vertexCount = GLsizei(vertices.size() / 3);
+
+    GLuint VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    stateBindVertexArray(VAO);
+    stateBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
+    glEnableVertexAttribArray(0);
+    stateBindBuffer(GL_ARRAY_BUFFER, 0);
+    stateBindVertexArray(0);
+    stateDeleteBuffer(VBO); // VAO mantém referência
+    return VAO;
+}
+
+// Desenha todos os traços em uma chamada (programa e VAO passam pelo cache de estado)
+void drawDashedLines(GLuint shaderID, GLuint dashVAO, GLsizei vertexCount, GLint colorLoc, GLint widthLoc,
+                     GLint heightLoc)
+{
+    stateUseProgram(shaderID);
+    glUniform4f(colorLoc, 0.5f, 0.5f, 0.5f, 1.0f);
+    glUniform1f(widthLoc, WIDTH);
+    glUniform1f(heightLoc, HEIGHT);
+    stateBindVertexArray(dashVAO);
+    glDrawArrays(GL_LINES, 0, vertexCount);
+}
+
 // Função para desenhar o círculo em um quadrante
 void drawCircleInQuadrant(GLuint shaderID, GLuint circleVAO, GLint colorLoc, GLint widthLoc, GLint heightLoc,
                           int viewportX, int viewportY, int viewportW, int viewportH)
 {
-    glViewport(viewportX, viewportY, viewportW, viewportH);
-    glUseProgram(shaderID);
+    stateViewport(viewportX, viewportY, viewportW, viewportH);
+    stateUseProgram(shaderID);
     glUniform1f(widthLoc, WIDTH);
     glUniform1f(heightLoc, HEIGHT);
     glUniform4f(colorLoc, 0.2f, 0.8f, 1.0f, 1.0f);
-    glBindVertexArray(circleVAO);
+    stateBindVertexArray(circleVAO);
     glDrawArrays(GL_TRIANGLE_FAN, 0, CIRCLE_SEGMENTS + 2);
-    glBindVertexArray(0);
 }
 
 int main()
@@ -154,6 +177,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Círculo em 4 quadrantes", nullptr, nullptr);
     if (!window) {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -171,23 +195,40 @@ int main()
 
     GLuint shaderID = setupShader();
     GLuint circleVAO = setupCircleVAO();
+    constexpr float dash = 10.0f, gap = 10.0f;
+    GLsizei dashVertices = 0;
+    GLuint dashVAO = setupDashedLinesVAO(dash, gap, dashVertices);
 
     GLint colorLoc = glGetUniformLocation(shaderID, "inputColor");
     GLint widthLoc = glGetUniformLocation(shaderID, "u_width");
     GLint heightLoc = glGetUniformLocation(shaderID, "u_height");
 
-    constexpr float dash = 10.0f, gap = 10.0f;
+    double prev_s = glfwGetTime();
+    double title_countdown_s = 0.1;
+    GLStateCounters counters;
 
+    captureInit();
     while (!glfwWindowShouldClose(window))
     {
+        double curr_s = glfwGetTime();
+        double elapsed_s = curr_s - prev_s;
+        prev_s = curr_s;
+        title_countdown_s -= elapsed_s;
+        if (title_countdown_s <= 0.0 && elapsed_s > 0.0) {
+            char tmp[160];
+            snprintf(tmp, sizeof(tmp), "Círculo em 4 quadrantes \tFPS %.2lf \tGL: %d enviadas, %d filtradas%s",
+                     1.0 / elapsed_s, counters.issued, counters.filtered, glState.enabled ? "" : " (cache desligado)");
+            glfwSetWindowTitle(window, tmp);
+            title_countdown_s = 0.1;
+        }
+
         glfwPollEvents();
-        glViewport(0, 0, WIDTH, HEIGHT);
-        glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
+        stateViewport(0, 0, WIDTH, HEIGHT);
+        stateClearColor(0.05f, 0.05f, 0.05f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
         // Linhas pontilhadas dos quadrantes
-        drawDashedLine(shaderID, colorLoc, widthLoc, heightLoc, WIDTH / 2, 0, WIDTH / 2, HEIGHT, dash, gap); // vertical
-        drawDashedLine(shaderID, colorLoc, widthLoc, heightLoc, 0, HEIGHT / 2, WIDTH, HEIGHT / 2, dash, gap); // horizontal
+        drawDashedLines(shaderID, dashVAO, dashVertices, colorLoc, widthLoc, heightLoc);
 
         // Círculo em cada quadrante
         drawCircleInQuadrant(shaderID, circleVAO, colorLoc, widthLoc, heightLoc, 0, HEIGHT / 2, WIDTH / 2, HEIGHT / 2); // sup. esq
@@ -195,10 +236,14 @@ int main()
         drawCircleInQuadrant(shaderID, circleVAO, colorLoc, widthLoc, heightLoc, 0, 0, WIDTH / 2, HEIGHT / 2); // inf. esq
         drawCircleInQuadrant(shaderID, circleVAO, colorLoc, widthLoc, heightLoc, WIDTH / 2, 0, WIDTH / 2, HEIGHT / 2); // inf. dir
 
+        counters = stateEndFrame();
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
-    glDeleteVertexArrays(1, &circleVAO);
+    stateDeleteVertexArray(circleVAO);
+    stateDeleteVertexArray(dashVAO);
     glfwTerminate();
     return 0;
 }
\ No newline at end of file
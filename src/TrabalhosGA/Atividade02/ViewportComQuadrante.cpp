@@ -3,10 +3,13 @@
 #include <array>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "lod.h"
+#include "frame_capture.h"
 
 constexpr GLuint WIDTH = 800, HEIGHT = 600;
-constexpr int CIRCLE_SEGMENTS = 100;
 constexpr float CX = 400.0f, CY = 300.0f, R = 100.0f;
+// O círculo é desenhado em um quadrante (metade da janela), logo ocupa R / 2 pixels na tela
+const int CIRCLE_SEGMENTS = lodSegmentsForRadius(R / 2.0f);
 
 // Vertex Shader
 const GLchar *vertexShaderSource = R"(
@@ -76,7 +79,7 @@ GLuint setupShader()
 
 GLuint setupCircleVAO()
 {
-    std::array<float, (CIRCLE_SEGMENTS + 2) * 3> vertices;
+    std::array<float, (LOD_MAX_SEGMENTS + 2) * 3> vertices;
     vertices[0] = CX;
     vertices[1] = CY;
     vertices[2] = 0.0f;
@@ -91,7 +94,7 @@ GLuint setupCircleVAO()
     glGenBuffers(1, &VBO);
     glBindVertexArray(VAO);
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, (CIRCLE_SEGMENTS + 2) * 3 * sizeof(float), vertices.data(), GL_STATIC_DRAW);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (GLvoid *)0);
     glEnableVertexAttribArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -152,6 +155,7 @@ int main()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Circulo no quadrante superior direito", nullptr, nullptr);
     if (!window) {
         std::cerr << "Falha ao criar a janela GLFW" << std::endl;
@@ -176,6 +180,7 @@ int main()
 
     constexpr float dash = 10.0f, gap = 10.0f;
 
+    captureInit();
     while (!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
@@ -197,8 +202,10 @@ int main()
         glDrawArrays(GL_TRIANGLE_FAN, 0, CIRCLE_SEGMENTS + 2);
         glBindVertexArray(0);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
     }
+    allocTrackStop();
 
     glDeleteVertexArrays(1, &circleVAO);
     glfwTerminate();
@@ -1,6 +1,7 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include "frame_capture.h"
 
 // Vertex shader
 const char* vertexShaderSource = R"(
@@ -31,6 +32,7 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow* window = glfwCreateWindow(800, 600, "Triângulo OpenGL", nullptr, nullptr);
     if (!window) {
         std::cerr << "Erro ao criar janela GLFW\n";
@@ -90,6 +92,7 @@ int main() {
     // Cor de fundo
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 
+    captureInit();
     // Loop de renderização
     while (!glfwWindowShouldClose(window)) {
         glClear(GL_COLOR_BUFFER_BIT);
@@ -98,9 +101,11 @@ int main() {
         glBindVertexArray(VAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
+    allocTrackStop();
 
     // Limpeza
     glDeleteVertexArrays(1, &VAO);
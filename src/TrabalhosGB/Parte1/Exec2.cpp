@@ -1,7 +1,11 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <cstdlib>
 #include <iostream>
 #include <vector>
+#include <unistd.h>
+#include "frame_capture.h"
+#include "scene_file.h"
 
 // --- Shaders (iguais ao anterior) ---
 const char* vertexShaderSource = R"(
@@ -48,16 +52,57 @@ GLuint createTriangle(float x0, float y0, float x1, float y1, float x2, float y2
 // --- Armazena os 5 triângulos ---
 std::vector<GLuint> triangles;
 
+// Vértices (x, y, z) dos 5 triângulos, também gravados com SCENE_FILE
+const float TRIANGLE_VERTICES[5][9] = {
+    {-0.8f, -0.5f, 0.0f, -0.6f, -0.5f, 0.0f, -0.7f, -0.2f, 0.0f},
+    {-0.4f, -0.5f, 0.0f, -0.2f, -0.5f, 0.0f, -0.3f, -0.2f, 0.0f},
+    {0.0f, -0.5f, 0.0f, 0.2f, -0.5f, 0.0f, 0.1f, -0.2f, 0.0f},
+    {0.4f, -0.5f, 0.0f, 0.6f, -0.5f, 0.0f, 0.5f, -0.2f, 0.0f},
+    {0.8f, -0.5f, 0.0f, 1.0f, -0.5f, 0.0f, 0.9f, -0.2f, 0.0f},
+};
+
 void setupTriangles() {
-    triangles.push_back(createTriangle(-0.8f, -0.5f, -0.6f, -0.5f, -0.7f, -0.2f));
-    triangles.push_back(createTriangle(-0.4f, -0.5f, -0.2f, -0.5f, -0.3f, -0.2f));
-    triangles.push_back(createTriangle(0.0f, -0.5f, 0.2f, -0.5f, 0.1f, -0.2f));
-    triangles.push_back(createTriangle(0.4f, -0.5f, 0.6f, -0.5f, 0.5f, -0.2f));
-    triangles.push_back(createTriangle(0.8f, -0.5f, 1.0f, -0.5f, 0.9f, -0.2f));
+    for (const auto &t : TRIANGLE_VERTICES)
+        triangles.push_back(createTriangle(t[0], t[1], t[3], t[4], t[6], t[7]));
+}
+
+// --- Cena em arquivo (SCENE_FILE=triangulos.cena) ---
+// Se o arquivo existe, os triângulos vêm dele (posição em float, um único VBO); senão os 5
+// triângulos acima são desenhados e gravados nele
+SceneMesh sceneTriangles;
+bool trianglesFromFile = false;
+
+bool loadTriangles(const char* path) {
+    SceneFile file;
+    if (access(path, F_OK) != 0 || !sceneOpen(path, file))
+        return false;
+    const SceneChunk* vertices = sceneFind(file, SCENE_VERTICES);
+    bool loaded = vertices && file.header->primitive == GL_TRIANGLES &&
+                  sceneHasLayout(*vertices, 3 * sizeof(float), {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, 0)}) &&
+                  sceneUpload(file, sceneTriangles);
+    if (loaded)
+        std::cout << path << ": " << sceneTriangles.count / 3 << " triângulos carregados\n";
+    else
+        std::cerr << path << ": a cena não tem os triângulos deste exercício, usando os 5 padrão\n";
+    sceneClose(file);
+    return loaded;
+}
+
+void saveTriangles(const char* path) {
+    const float bounds[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+    SceneChunkData vertices{sceneChunk(SCENE_VERTICES, sizeof(TRIANGLE_VERTICES) / (3 * sizeof(float)), 3 * sizeof(float),
+                                       {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, 0)}),
+                            TRIANGLE_VERTICES};
+    if (sceneSave(path, GL_TRIANGLES, bounds, {vertices}))
+        std::cout << "Triângulos gravados em " << path << "\n";
 }
 
 void renderTriangles(GLuint shaderProgram) {
     glUseProgram(shaderProgram);
+    if (trianglesFromFile) {
+        sceneDraw(sceneTriangles);
+        return;
+    }
     for (auto vao : triangles) {
         glBindVertexArray(vao);
         glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -76,6 +121,7 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
     GLFWwindow* window = glfwCreateWindow(800, 600, "5 Triângulos OpenGL", nullptr, nullptr);
     if (!window) {
         std::cerr << "Erro ao criar janela GLFW\n";
@@ -110,25 +156,35 @@ int main() {
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
-    // --- Cria os 5 triângulos ---
-    setupTriangles();
+    // --- Carrega os triângulos do arquivo ou cria os 5 padrão ---
+    const char* sceneFile = getenv("SCENE_FILE");
+    trianglesFromFile = sceneFile && loadTriangles(sceneFile);
+    if (!trianglesFromFile) {
+        setupTriangles();
+        if (sceneFile && access(sceneFile, F_OK) != 0)
+            saveTriangles(sceneFile);
+    }
 
     // Define cor de fundo
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 
+    captureInit();
     // Loop principal
     while (!glfwWindowShouldClose(window)) {
         glClear(GL_COLOR_BUFFER_BIT);
 
         renderTriangles(shaderProgram);
 
+        captureEndFrame(window);
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
+    allocTrackStop();
 
     // Limpa memória
     for (auto vao : triangles)
         glDeleteVertexArrays(1, &vao);
+    deleteSceneMesh(sceneTriangles);
 
     glDeleteProgram(shaderProgram);
     glfwTerminate();
@@ -4,8 +4,16 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <vector>
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <iostream>
+#include <unistd.h>
+#include "profiler.h"
+#include "input_replay.h"
+#include "frame_capture.h"
+#include "scene_file.h"
+#include "job_system.h"
 
 // --- Shaders com suporte a transformação e cor ---
 const char* vertexShaderSource = R"(
@@ -36,6 +44,12 @@ struct Triangle {
 
 GLuint triangleVAO;
 std::vector<Triangle> triangleList;
+std::vector<glm::mat4> transformList; // uma por triângulo, montadas pelos jobs a cada frame
+JobSystem jobs;
+const size_t RESERVED_TRIANGLES = 100000; // reservado no início: o clique só aloca depois disso
+const size_t TRANSFORM_GRAIN = 4096;      // triângulos por job
+// Vértices (x, y, z) do triângulo base, centrado na origem
+const float BASE_TRIANGLE[9] = {-0.1f, -0.1f, 0.0f, 0.1f, -0.1f, 0.0f, 0.0f, 0.1f, 0.0f};
 
 // --- Função para criar um triângulo base (VAO) ---
 GLuint createTriangle(float x0, float y0, float x1, float y1, float x2, float y2) {
@@ -64,11 +78,49 @@ GLuint createTriangle(float x0, float y0, float x1, float y1, float x2, float y2
 
 // --- Cria o triângulo base padrão ---
 void setupBaseTriangle() {
-    triangleVAO = createTriangle(-0.1f, -0.1f, 0.1f, -0.1f, 0.0f, 0.1f);
+    const float *v = BASE_TRIANGLE;
+    triangleVAO = createTriangle(v[0], v[1], v[3], v[4], v[6], v[7]);
+    triangleList.reserve(RESERVED_TRIANGLES);
+    transformList.reserve(RESERVED_TRIANGLES);
+}
+
+// --- Cena em arquivo (SCENE_FILE=arquivo.cena): carregada no início, se existir, e gravada ao sair ---
+// O triângulo base vai como pedaço de vértices e os triângulos clicados como instâncias
+// (deslocamento + cor), o mesmo layout de Triangle, gravado direto do vetor.
+
+void loadScene(const char *path) {
+    SceneFile file;
+    if (access(path, F_OK) != 0 || !sceneOpen(path, file))
+        return;
+    const SceneChunk *instances = sceneFind(file, SCENE_INSTANCES);
+    if (instances && sceneHasLayout(*instances, sizeof(Triangle),
+                                    {sceneAttribute(SCENE_OFFSET, 2, GL_FLOAT, offsetof(Triangle, position)),
+                                     sceneAttribute(SCENE_COLOR, 3, GL_FLOAT, offsetof(Triangle, color))})) {
+        const Triangle *t = sceneChunkData<Triangle>(file, *instances);
+        triangleList.assign(t, t + instances->count);
+        std::cout << path << ": " << triangleList.size() << " triângulos carregados\n";
+    } else {
+        std::cerr << path << ": a cena não tem os triângulos deste exercício\n";
+    }
+    sceneClose(file);
+}
+
+void saveScene(const char *path) {
+    const float bounds[4] = {-1.0f, -1.0f, 1.0f, 1.0f};
+    SceneChunkData base{sceneChunk(SCENE_VERTICES, 3, 3 * sizeof(float),
+                                   {sceneAttribute(SCENE_POSITION, 3, GL_FLOAT, 0)}),
+                        BASE_TRIANGLE};
+    SceneChunkData instances{sceneChunk(SCENE_INSTANCES, uint32_t(triangleList.size()), sizeof(Triangle),
+                                        {sceneAttribute(SCENE_OFFSET, 2, GL_FLOAT, offsetof(Triangle, position)),
+                                         sceneAttribute(SCENE_COLOR, 3, GL_FLOAT, offsetof(Triangle, color))}),
+                             triangleList.data()};
+    if (sceneSave(path, GL_TRIANGLES, bounds, {base, instances}))
+        std::cout << path << ": " << triangleList.size() << " triângulos gravados\n";
 }
 
 // --- Gera um triângulo na posição do clique com cor aleatória ---
 void onMouseClick(float x, float y) {
+    PROF_ZONE("clique");
     // converte coordenadas de tela (pixel) para coordenadas normalizadas (-1 a 1)
     int width, height;
     glfwGetFramebufferSize(glfwGetCurrentContext(), &width, &height);
@@ -82,22 +134,48 @@ void onMouseClick(float x, float y) {
         static_cast<float>(rand()) / RAND_MAX,
         static_cast<float>(rand()) / RAND_MAX
     );
+    // Depois da reserva o vetor dobra de vez em quando: alocação prevista
+    AllocTrackExpected growth(triangleList.size() == triangleList.capacity());
     triangleList.push_back(t);
 }
 
+// --- Monta as matrizes de todos os triângulos em paralelo, um job por bloco ---
+void buildTransforms() {
+    PROF_ZONE("transformações");
+    size_t count = triangleList.size();
+    {
+        AllocTrackExpected growth(count > transformList.capacity());
+        transformList.resize(count);
+    }
+    JobCounter built;
+    // O jobSubmit aloca cada job (o job_system.h não tem pool): alocação prevista
+    AllocTrackExpected jobAllocations;
+    for (size_t first = 0; first < count; first += TRANSFORM_GRAIN) {
+        size_t last = std::min(count, first + TRANSFORM_GRAIN);
+        jobSubmit(jobs, [first, last] {
+            for (size_t i = first; i < last; ++i)
+                transformList[i] = glm::translate(glm::mat4(1.0f), glm::vec3(triangleList[i].position, 0.0f));
+        }, &built);
+    }
+    jobWait(jobs, built);
+}
+
 // --- Renderiza todos os triângulos com matriz de transformação ---
+// As chamadas de GL ficam na thread do contexto; só as matrizes vêm dos jobs
 void renderTrianglesWithTransform(GLuint shaderProgram) {
+    buildTransforms();
+
+    PROF_ZONE("envio dos desenhos");
+    PROF_GPU_ZONE("triângulos");
     glUseProgram(shaderProgram);
     glBindVertexArray(triangleVAO);
 
-    for (const auto& t : triangleList) {
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(t.position, 0.0f));
-
+    for (size_t i = 0; i < triangleList.size(); ++i) {
         GLuint transformLoc = glGetUniformLocation(shaderProgram, "transform");
-        glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+        glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transformList[i]));
 
         GLuint colorLoc = glGetUniformLocation(shaderProgram, "color");
-        glUniform3fv(colorLoc, 1, glm::value_ptr(t.color));
+        glUniform3fv(colorLoc, 1, glm::value_ptr(triangleList[i].color));
 
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
@@ -107,11 +185,19 @@ void renderTrianglesWithTransform(GLuint shaderProgram) {
 void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS) {
         double xpos, ypos;
-        glfwGetCursorPos(window, &xpos, &ypos);
+        inputCursorPos(window, &xpos, &ypos);
         onMouseClick(static_cast<float>(xpos), static_cast<float>(ypos));
     }
 }
 
+// --- Callback de teclado: ESC fecha, P grava o perfil (PROF_TRACE) sem sair ---
+void keyCallback(GLFWwindow* window, int key, int, int action, int) {
+    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, GL_TRUE);
+    if (key == GLFW_KEY_P && action == GLFW_PRESS)
+        profWriteChromeTrace();
+}
+
 // --- Programa principal ---
 int main() {
     if (!glfwInit()) {
@@ -123,6 +209,8 @@ int main() {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    captureWindowHints();
+    inputWindowHints();
     GLFWwindow* window = glfwCreateWindow(800, 600, "Triângulos com GLM", nullptr, nullptr);
     if (!window) {
         std::cerr << "Erro ao criar janela GLFW\n";
@@ -139,6 +227,12 @@ int main() {
 
     glViewport(0, 0, 800, 600);
     glfwSetMouseButtonCallback(window, mouseButtonCallback);
+    glfwSetKeyCallback(window, keyCallback);
+    // INPUT_RECORD grava os cliques; INPUT_REPLAY/INPUT_SYNTH reproduzem e medem os frames
+    inputInit(window);
+
+    // PROF_TRACE=perfil.json grava a linha do tempo de CPU e GPU ao sair
+    profInit();
 
     // --- Shaders ---
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
@@ -158,19 +252,39 @@ int main() {
 
     // Cria o triângulo base
     setupBaseTriangle();
+    jobSystemStart(jobs, 0); // um worker por núcleo, contando a thread principal
+    const char *sceneFile = getenv("SCENE_FILE");
+    if (sceneFile)
+        loadScene(sceneFile);
 
     // Define cor de fundo
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 
+    captureInit();
     // Loop principal
     while (!glfwWindowShouldClose(window)) {
         glClear(GL_COLOR_BUFFER_BIT);
 
         renderTrianglesWithTransform(shaderProgram);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        profEndFrame();
+        {
+            PROF_ZONE("troca de buffers");
+            captureEndFrame(window);
+            glfwSwapBuffers(window);
+        }
+        {
+            PROF_ZONE("eventos");
+            inputPollEvents(window);
+        }
     }
+    allocTrackStop();
+    jobSystemStop(jobs);
+
+    inputShutdown();
+    profShutdown();
+    if (sceneFile)
+        saveScene(sceneFile);
 
     glDeleteVertexArrays(1, &triangleVAO);
     glDeleteProgram(shaderProgram);